@@ -11,6 +11,7 @@ error() {
 BUILD_TYPE="Debug"
 JOBS="$(sysctl -n hw.ncpu 2>/dev/null || echo 4)"
 RUN_TESTS=0
+BENCHMARKS="OFF"
 CLEAN=0
 TARGET=""
 
@@ -20,6 +21,7 @@ Usage: $(basename "$0") [options]
   -r, --release Build   Release (default: Debug)
   -d, --debug           Build Debug
   -t, --tests           Run tests after build (ctest)
+  -b, --benchmarks      Build the *_bench targets (google benchmark, -march=native)
   -c, --clean           Delete the build dir before configuring
   -T, --target NAME     Build a specific target (e.g., 01_singleton, all_patterns)
   -h, --help
@@ -32,6 +34,7 @@ while [[ $# -gt 0 ]]; do
     -r|--release) BUILD_TYPE="Release"; shift ;;
     -d|--debug)   BUILD_TYPE="Debug";   shift ;;
     -t|--tests)   RUN_TESTS=1;          shift ;;
+    -b|--benchmarks) BENCHMARKS="ON";   shift ;;
     -c|--clean)   CLEAN=1;              shift ;;
     -T|--target)  TARGET="${2:?}";      shift 2 ;;
     -h|--help)    usage ;;
@@ -79,7 +82,9 @@ cmake -S "${REPO_ROOT}" -B "${BUILD_DIR}" \
   -DCMAKE_OSX_DEPLOYMENT_TARGET=13.0 \
   -DVCPKG_FEATURE_FLAGS=manifests \
   -DVCPKG_TARGET_TRIPLET=x64-osx \
-  -DBUILD_TESTING=ON
+  -DBUILD_TESTING=ON \
+  -DBUILD_BENCHMARKS="${BENCHMARKS}" \
+  -DGOF23_MARCH_NATIVE="${BENCHMARKS}"
 
 if [[ -n "${TARGET}" ]]; then
   info "[build] Target: ${TARGET}"
@@ -0,0 +1,59 @@
+#ifndef GOF23_BASIC_OPTION_H
+#define GOF23_BASIC_OPTION_H
+
+#include <concepts>
+#include <utility>
+
+#include "bridge.h"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+// Anything with PriceEngine's Price signature, derived from it or not.
+template <class E>
+concept StaticPriceEngine =
+    requires(const E& kEngine, const double kVal, const Right kRight) {
+      {
+        kEngine.Price(kVal, kVal, kVal, kVal, kVal, kRight)
+      } -> std::convertible_to<double>;
+    };
+
+// The compile-time side of the bridge: EuropeanOption with its engine named
+// by type and held by value. The engine's dynamic type is then known, so
+// Value() is a direct call the compiler can inline into a pricing loop, with
+// no vtable or shared_ptr to chase. Keep EuropeanOption where the engine has
+// to be swapped at runtime.
+template <StaticPriceEngine Engine>
+struct BasicEuropeanOption {
+  // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+  explicit BasicEuropeanOption(const double kSpot, const double kStrike,
+                               const double kTime, const double kRate,
+                               const double kSigma, const Right kRight,
+                               Engine engine = Engine{})
+      : spot_(kSpot),
+        strike_(kStrike),
+        time_(kTime),
+        rate_(kRate),
+        sigma_(kSigma),
+        right_(kRight),
+        engine_(std::move(engine)) {}
+
+  [[nodiscard]] double Value() const {
+    return engine_.Price(spot_, strike_, time_, rate_, sigma_, right_);
+  }
+
+  [[nodiscard]] Greeks Risk() const
+    requires std::derived_from<Engine, PriceEngine>
+  {
+    return engine_.Risk(spot_, strike_, time_, rate_, sigma_, right_);
+  }
+
+  double spot_, strike_, time_, rate_, sigma_;
+  Right right_;
+  Engine engine_;
+};
+
+using BlackScholesOption = BasicEuropeanOption<BlackScholesEngine>;
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_BASIC_OPTION_H
@@ -0,0 +1,67 @@
+#include "basic_option.h"
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "bridge.h"
+#include "random_chain.h"
+
+namespace {
+
+constexpr std::size_t kChainSize = 1 << 14;
+
+void SetOptionsPerSecond(benchmark::State& state) {
+  state.counters["options/s"] =
+      benchmark::Counter(static_cast<double>(kChainSize),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Runtime binding: a virtual Value() that makes a virtual Price() call
+// through the option's shared engine.
+template <class Engine>
+void BM_RuntimeOption(benchmark::State& state) {
+  const RandomChain kChain(kChainSize);
+  const auto kEngine = std::make_shared<Engine>();
+  std::vector<std::unique_ptr<Option>> options;
+  for (std::size_t i = 0; i < kChainSize; ++i) {
+    auto option = std::make_unique<EuropeanOption>(
+        kChain.spot_[i], kChain.strike_[i], kChain.time_[i], kChain.rate_[i],
+        kChain.sigma_[i], kChain.right_[i]);
+    option->SetEngine(kEngine);
+    options.push_back(std::move(option));
+  }
+
+  for (auto _ : state) {
+    double total = 0;
+    for (const auto& kOption : options) total += kOption->Value();
+    benchmark::DoNotOptimize(total);
+  }
+  SetOptionsPerSecond(state);
+}
+
+template <class Engine>
+void BM_BasicOption(benchmark::State& state) {
+  const RandomChain kChain(kChainSize);
+  std::vector<BasicEuropeanOption<Engine>> options;
+  for (std::size_t i = 0; i < kChainSize; ++i) {
+    options.emplace_back(kChain.spot_[i], kChain.strike_[i], kChain.time_[i],
+                         kChain.rate_[i], kChain.sigma_[i], kChain.right_[i]);
+  }
+
+  for (auto _ : state) {
+    double total = 0;
+    for (const auto& kOption : options) total += kOption.Value();
+    benchmark::DoNotOptimize(total);
+  }
+  SetOptionsPerSecond(state);
+}
+
+}  // namespace
+
+// The dummy engine is almost free, so it shows the binding overhead alone.
+BENCHMARK(BM_RuntimeOption<DummyEngine>);
+BENCHMARK(BM_BasicOption<DummyEngine>);
+BENCHMARK(BM_RuntimeOption<BlackScholesEngine>);
+BENCHMARK(BM_BasicOption<BlackScholesEngine>);
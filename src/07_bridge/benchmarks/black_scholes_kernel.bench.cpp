@@ -0,0 +1,58 @@
+#include "black_scholes_kernel.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "bridge.h"
+#include "random_chain.h"
+
+namespace {
+
+void SetOptionsPerSecond(benchmark::State& state, const std::size_t kSize) {
+  state.counters["options/s"] =
+      benchmark::Counter(static_cast<double>(kSize),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// One virtual Price call per option, as EuropeanOption::Value does today.
+void BM_ScalarPrice(benchmark::State& state) {
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+  const RandomChain kChain(kSize);
+  const std::unique_ptr<PriceEngine> kEngine =
+      std::make_unique<BlackScholesEngine>();
+  std::vector<double> out(kSize);
+
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kSize; ++i) {
+      out[i] = kEngine->Price(kChain.spot_[i], kChain.strike_[i],
+                              kChain.time_[i], kChain.rate_[i],
+                              kChain.sigma_[i], kChain.right_[i]);
+    }
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  SetOptionsPerSecond(state, kSize);
+}
+
+void BM_PriceBatch(benchmark::State& state) {
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+  const RandomChain kChain(kSize);
+  const std::unique_ptr<PriceEngine> kEngine =
+      std::make_unique<BlackScholesEngine>();
+  std::vector<double> out(kSize);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kEngine->PriceBatch(kChain.Batch(), out));
+    benchmark::ClobberMemory();
+  }
+  SetOptionsPerSecond(state, kSize);
+  state.SetLabel(std::string(BatchKernelIsa()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_ScalarPrice)->RangeMultiplier(8)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_PriceBatch)->RangeMultiplier(8)->Range(1 << 10, 1 << 16);
@@ -0,0 +1,94 @@
+#include "caching_engine.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "bridge.h"
+#include "random_chain.h"
+
+namespace {
+
+constexpr std::size_t kLookups = 1 << 14;
+constexpr std::size_t kCapacity = 1 << 14;
+
+// kLookups requests drawn from a universe of range(0) distinct options: the
+// smaller the universe relative to the table, the more repeats between
+// ticks and the higher the hit rate.
+struct Workload {
+  explicit Workload(const std::size_t kUniverse) : chain_(kUniverse) {
+    std::mt19937_64 rng(kUniverse);
+    std::uniform_int_distribution<std::size_t> pick(0, kUniverse - 1);
+    for (std::size_t i = 0; i < kLookups; ++i) order_.push_back(pick(rng));
+  }
+
+  RandomChain chain_;
+  std::vector<std::size_t> order_;
+};
+
+template <class Engine>
+double PriceAll(const Engine& kEngine, const Workload& kWork) {
+  double total = 0;
+  for (const std::size_t kI : kWork.order_) {
+    total += kEngine.Price(kWork.chain_.spot_[kI], kWork.chain_.strike_[kI],
+                           kWork.chain_.time_[kI], kWork.chain_.rate_[kI],
+                           kWork.chain_.sigma_[kI], kWork.chain_.right_[kI]);
+  }
+  return total;
+}
+
+void SetOptionsPerSecond(benchmark::State& state) {
+  state.counters["options/s"] =
+      benchmark::Counter(static_cast<double>(kLookups),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_Uncached(benchmark::State& state) {
+  const Workload kWork(static_cast<std::size_t>(state.range(0)));
+  const BlackScholesEngine kEngine;
+  const PriceEngine& engine = kEngine;
+  for (auto _ : state) benchmark::DoNotOptimize(PriceAll(engine, kWork));
+  SetOptionsPerSecond(state);
+}
+
+void BM_Cached(benchmark::State& state) {
+  const Workload kWork(static_cast<std::size_t>(state.range(0)));
+  CachingEngine::Options options;
+  options.capacity_ = kCapacity;
+  const CachingEngine kEngine(std::make_shared<BlackScholesEngine>(),
+                              options);
+  const PriceEngine& engine = kEngine;
+  for (auto _ : state) benchmark::DoNotOptimize(PriceAll(engine, kWork));
+  SetOptionsPerSecond(state);
+
+  const CachingEngine::Stats kStats = kEngine.GetStats();
+  state.counters["hit_rate"] =
+      static_cast<double>(kStats.hits_) /
+      static_cast<double>(kStats.hits_ + kStats.misses_);
+}
+
+// Every benchmark thread reads the one shared, warm cache.
+void BM_CachedConcurrent(benchmark::State& state) {
+  static const Workload kWork(1 << 10);
+  static const CachingEngine kEngine(std::make_shared<BlackScholesEngine>());
+  const PriceEngine& engine = kEngine;
+  for (auto _ : state) benchmark::DoNotOptimize(PriceAll(engine, kWork));
+  SetOptionsPerSecond(state);
+}
+
+}  // namespace
+
+BENCHMARK(BM_Uncached)->Arg(1 << 10);
+BENCHMARK(BM_Cached)
+    ->RangeMultiplier(4)
+    ->Range(1 << 8, 1 << 18)
+    ->ArgName("universe");
+BENCHMARK(BM_CachedConcurrent)
+    ->ThreadRange(1, static_cast<int>(std::max(
+                         1U, std::thread::hardware_concurrency())))
+    ->UseRealTime();
@@ -0,0 +1,63 @@
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "bridge.h"
+#include "random_chain.h"
+
+namespace {
+
+constexpr std::size_t kChainSize = 1 << 14;
+
+void SetOptionsPerSecond(benchmark::State& state) {
+  state.counters["options/s"] =
+      benchmark::Counter(static_cast<double>(kChainSize),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Today's risk refresh: 13 reprices per option through the base class.
+void BM_RiskBumped(benchmark::State& state) {
+  const RandomChain kChain(kChainSize);
+  const BlackScholesEngine kEngine;
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kChainSize; ++i) {
+      benchmark::DoNotOptimize(kEngine.PriceEngine::Risk(
+          kChain.spot_[i], kChain.strike_[i], kChain.time_[i],
+          kChain.rate_[i], kChain.sigma_[i], kChain.right_[i]));
+    }
+  }
+  SetOptionsPerSecond(state);
+}
+
+void BM_RiskAnalytic(benchmark::State& state) {
+  const RandomChain kChain(kChainSize);
+  const BlackScholesEngine kEngine;
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kChainSize; ++i) {
+      benchmark::DoNotOptimize(
+          kEngine.Risk(kChain.spot_[i], kChain.strike_[i], kChain.time_[i],
+                       kChain.rate_[i], kChain.sigma_[i], kChain.right_[i]));
+    }
+  }
+  SetOptionsPerSecond(state);
+}
+
+void BM_RiskBatch(benchmark::State& state) {
+  const RandomChain kChain(kChainSize);
+  const BlackScholesEngine kEngine;
+  std::vector<std::vector<double>> columns(8,
+                                           std::vector<double>(kChainSize));
+  const GreeksBatch kOut{columns[0], columns[1], columns[2], columns[3],
+                         columns[4], columns[5], columns[6], columns[7]};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kEngine.RiskBatch(kChain.Batch(), kOut));
+    benchmark::ClobberMemory();
+  }
+  SetOptionsPerSecond(state);
+}
+
+}  // namespace
+
+BENCHMARK(BM_RiskBumped);
+BENCHMARK(BM_RiskAnalytic);
+BENCHMARK(BM_RiskBatch);
@@ -0,0 +1,83 @@
+#include "implied_vol.h"
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "bridge.h"
+#include "random_chain.h"
+
+namespace {
+
+// A listed chain: ~64 strikes x 2 rights on one underlying.
+constexpr std::size_t kChainSize = 128;
+
+struct QuotedChain {
+  QuotedChain() : chain_(kChainSize), price_(kChainSize), vol_(kChainSize) {
+    const BlackScholesEngine kEngine;
+    (void)kEngine.PriceBatch(chain_.Batch(), price_);
+  }
+
+  [[nodiscard]] QuoteBatch Quotes() const {
+    return {chain_.spot_,  chain_.strike_, chain_.time_,
+            chain_.rate_,  price_,         chain_.right_};
+  }
+
+  RandomChain chain_;
+  std::vector<double> price_;
+  std::vector<double> vol_;
+};
+
+void SetChainsPerSecond(benchmark::State& state) {
+  state.counters["chains/s"] =
+      benchmark::Counter(1, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_ImpliedVolBisection(benchmark::State& state) {
+  QuotedChain quoted;
+  const ImpliedVolSolver kSolver;
+  const BlackScholesEngine kEngine;
+  const PriceEngine& engine = kEngine;
+  const RandomChain& kChain = quoted.chain_;
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kChainSize; ++i) {
+      quoted.vol_[i] = kSolver.Bisect(engine, kChain.spot_[i],
+                                      kChain.strike_[i], kChain.time_[i],
+                                      kChain.rate_[i], quoted.price_[i],
+                                      kChain.right_[i]);
+    }
+    benchmark::ClobberMemory();
+  }
+  SetChainsPerSecond(state);
+}
+
+void BM_ImpliedVolScalar(benchmark::State& state) {
+  QuotedChain quoted;
+  const ImpliedVolSolver kSolver;
+  const RandomChain& kChain = quoted.chain_;
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kChainSize; ++i) {
+      quoted.vol_[i] =
+          kSolver.Solve(kChain.spot_[i], kChain.strike_[i], kChain.time_[i],
+                        kChain.rate_[i], quoted.price_[i], kChain.right_[i]);
+    }
+    benchmark::ClobberMemory();
+  }
+  SetChainsPerSecond(state);
+}
+
+void BM_ImpliedVolBatch(benchmark::State& state) {
+  QuotedChain quoted;
+  const ImpliedVolSolver kSolver;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kSolver.SolveBatch(quoted.Quotes(), quoted.vol_));
+    benchmark::ClobberMemory();
+  }
+  SetChainsPerSecond(state);
+}
+
+}  // namespace
+
+BENCHMARK(BM_ImpliedVolBisection)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ImpliedVolScalar)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ImpliedVolBatch)->Unit(benchmark::kMicrosecond);
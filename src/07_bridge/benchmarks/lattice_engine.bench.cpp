@@ -0,0 +1,97 @@
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "bridge.h"
+
+namespace {
+
+// A listed chain on one underlying and expiry: 32 strikes x 2 rights.
+struct Chain {
+  Chain() {
+    for (int i = 0; i < 32; ++i) {
+      for (const Right kRight : {Right::kCall, Right::kPut}) {
+        strikes_.push_back(70 + (2.0 * i));
+        rights_.push_back(kRight);
+      }
+    }
+  }
+
+  std::vector<double> strikes_;
+  std::vector<Right> rights_;
+};
+
+constexpr double kSpot = 100;
+constexpr double kTime = 1;
+constexpr double kRate = 0.03;
+constexpr double kSigma = 0.25;
+
+LatticeEngine::Tree TreeArg(const benchmark::State& kState) {
+  return kState.range(1) == 0 ? LatticeEngine::Tree::kBinomial
+                              : LatticeEngine::Tree::kTrinomial;
+}
+
+// steps/s counts one backward step of one option; nodes/s the node updates
+// behind it, which grow with the step count (and double on a trinomial tree).
+void SetRates(benchmark::State& state, const double kOptions) {
+  const auto kSteps = static_cast<double>(state.range(0));
+  const double kNodesPerLevel =
+      TreeArg(state) == LatticeEngine::Tree::kBinomial ? 0.5 : 1.0;
+  state.counters["steps/s"] = benchmark::Counter(
+      kOptions * kSteps, benchmark::Counter::kIsIterationInvariantRate);
+  state.counters["nodes/s"] = benchmark::Counter(
+      kOptions * kSteps * kSteps * kNodesPerLevel,
+      benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_LatticePrice(benchmark::State& state) {
+  const LatticeEngine kEngine(static_cast<int>(state.range(0)),
+                              TreeArg(state));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        kEngine.Price(kSpot, 100, kTime, kRate, kSigma, Right::kPut));
+  }
+  SetRates(state, 1);
+}
+
+// The chain one Price call at a time: every option rebuilds the same tree.
+void BM_LatticeChainPerOption(benchmark::State& state) {
+  const Chain kChain;
+  const LatticeEngine kEngine(static_cast<int>(state.range(0)),
+                              TreeArg(state));
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kChain.strikes_.size(); ++i) {
+      benchmark::DoNotOptimize(kEngine.Price(kSpot, kChain.strikes_[i], kTime,
+                                             kRate, kSigma,
+                                             kChain.rights_[i]));
+    }
+  }
+  SetRates(state, static_cast<double>(kChain.strikes_.size()));
+}
+
+void BM_LatticeChainSweep(benchmark::State& state) {
+  const Chain kChain;
+  const LatticeEngine kEngine(static_cast<int>(state.range(0)),
+                              TreeArg(state));
+  std::vector<double> out(kChain.strikes_.size());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kEngine.PriceSweep(
+        kSpot, kTime, kRate, kSigma, kChain.strikes_, kChain.rights_, out));
+    benchmark::ClobberMemory();
+  }
+  SetRates(state, static_cast<double>(kChain.strikes_.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_LatticePrice)
+    ->ArgsProduct({{100, 500, 2000}, {0, 1}})
+    ->ArgNames({"steps", "trinomial"});
+BENCHMARK(BM_LatticeChainPerOption)
+    ->ArgsProduct({{500, 2000}, {0, 1}})
+    ->ArgNames({"steps", "trinomial"})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LatticeChainSweep)
+    ->ArgsProduct({{500, 2000}, {0, 1}})
+    ->ArgNames({"steps", "trinomial"})
+    ->Unit(benchmark::kMillisecond);
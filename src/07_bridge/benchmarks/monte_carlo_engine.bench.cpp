@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include "bridge.h"
+
+namespace {
+
+constexpr std::uint64_t kPaths = 1 << 20;
+
+void SetPathsPerSecond(benchmark::State& state,
+                       const MonteCarloEngine::Options& kOptions) {
+  state.counters["paths/s"] =
+      benchmark::Counter(static_cast<double>(kOptions.paths_),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Paths/s from one thread up to every core; the estimate is the same at
+// every point.
+void BM_MonteCarloScaling(benchmark::State& state) {
+  MonteCarloEngine::Options options;
+  options.paths_ = kPaths;
+  options.threads_ = static_cast<unsigned>(state.range(0));
+  const MonteCarloEngine kEngine(options);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        kEngine.Price(100, 100, 1, 0.03, 0.25, Right::kPut));
+  }
+  SetPathsPerSecond(state, options);
+}
+
+// A 12-date Asian under each variance reduction; std_error is what the
+// extra work per path buys.
+void BM_MonteCarloVarianceReduction(benchmark::State& state) {
+  MonteCarloEngine::Options options;
+  options.paths_ = kPaths;
+  options.steps_ = 12;
+  options.payoff_ = std::make_shared<AsianPayoff>();
+  options.antithetic_ = state.range(0) > 0;
+  options.control_variate_ = state.range(0) > 1;
+  const MonteCarloEngine kEngine(options);
+  MonteCarloEngine::Estimate estimate;
+  for (auto _ : state) {
+    estimate = kEngine.Simulate(100, 100, 1, 0.03, 0.25, Right::kCall);
+    benchmark::DoNotOptimize(estimate);
+  }
+  SetPathsPerSecond(state, options);
+  state.counters["std_error"] = estimate.std_error_;
+  state.SetLabel(state.range(0) == 0   ? "plain"
+                 : state.range(0) == 1 ? "antithetic"
+                                       : "antithetic+control");
+}
+
+// Many small pricings on one four-thread engine, the case where starting
+// threads per call would cost more than the paths.
+void BM_MonteCarloSmallPricings(benchmark::State& state) {
+  MonteCarloEngine::Options options;
+  options.paths_ = static_cast<std::uint64_t>(state.range(0));
+  options.threads_ = 4;
+  const MonteCarloEngine kEngine(options);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        kEngine.Price(100, 100, 1, 0.03, 0.25, Right::kPut));
+  }
+  SetPathsPerSecond(state, options);
+}
+
+}  // namespace
+
+BENCHMARK(BM_MonteCarloScaling)
+    ->DenseRange(1, static_cast<int>(std::max(
+                        1U, std::thread::hardware_concurrency())))
+    ->ArgName("threads")
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MonteCarloVarianceReduction)
+    ->DenseRange(0, 2)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MonteCarloSmallPricings)
+    ->RangeMultiplier(4)
+    ->Range(1 << 13, 1 << 17)
+    ->ArgName("paths")
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
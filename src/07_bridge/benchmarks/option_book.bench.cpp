@@ -0,0 +1,77 @@
+#include "option_book.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <absl/strings/str_cat.h>
+#include <benchmark/benchmark.h>
+
+#include "bridge.h"
+#include "random_chain.h"
+
+namespace {
+
+constexpr std::size_t kUnderlyings = 500;
+constexpr std::size_t kOptionsPerUnderlying = 64;
+
+// kUnderlyings names with kOptionsPerUnderlying options each; every option
+// on a name takes that name's first spot.
+struct Book {
+  Book() : book_(engine_) {
+    const RandomChain kChain(kUnderlyings * kOptionsPerUnderlying);
+    for (std::size_t i = 0; i < kChain.spot_.size(); ++i) {
+      const std::size_t kName = i / kOptionsPerUnderlying;
+      if (i % kOptionsPerUnderlying == 0) {
+        spot_.push_back(kChain.spot_[i]);
+        names_.push_back(absl::StrCat("U", kName));
+      }
+      options_.emplace_back(spot_[kName], kChain.strike_[i], kChain.time_[i],
+                            kChain.rate_[i], kChain.sigma_[i],
+                            kChain.right_[i]);
+      options_.back().SetEngine(engine_);
+      (void)book_.Add(names_[kName], options_.back());
+    }
+  }
+
+  std::shared_ptr<BlackScholesEngine> engine_ =
+      std::make_shared<BlackScholesEngine>();
+  OptionBook book_;
+  std::vector<std::string> names_;
+  std::vector<double> spot_;
+  std::vector<EuropeanOption> options_;
+};
+
+// The baseline: a tick on any name revalues every option in the book.
+void BM_FullRevaluation(benchmark::State& state) {
+  const Book kBook;
+  for (auto _ : state) {
+    double total = 0;
+    for (const EuropeanOption& kOption : kBook.options_) {
+      total += kOption.Value();
+    }
+    benchmark::DoNotOptimize(total);
+  }
+}
+
+// A tick on one name through the book, cycling the names and alternating
+// the spot so every update moves prices.
+void BM_UpdateSpot(benchmark::State& state) {
+  Book book;
+  std::size_t tick = 0;
+  for (auto _ : state) {
+    const std::size_t kName = tick % kUnderlyings;
+    const double kBump = (tick / kUnderlyings) % 2 == 0 ? 1.001 : 1.0;
+    benchmark::DoNotOptimize(
+        book.book_.UpdateSpot(book.names_[kName], book.spot_[kName] * kBump));
+    benchmark::DoNotOptimize(book.book_.TakeDirty());
+    ++tick;
+  }
+  state.counters["options/tick"] = static_cast<double>(kOptionsPerUnderlying);
+}
+
+}  // namespace
+
+BENCHMARK(BM_FullRevaluation);
+BENCHMARK(BM_UpdateSpot);
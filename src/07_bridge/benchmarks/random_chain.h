@@ -0,0 +1,38 @@
+#ifndef GOF23_BRIDGE_RANDOM_CHAIN_H
+#define GOF23_BRIDGE_RANDOM_CHAIN_H
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "bridge.h"
+
+// A reproducible structure-of-arrays chain of listed-looking options shared by
+// the bridge benchmarks.
+struct RandomChain {
+  explicit RandomChain(const std::size_t kSize) {
+    std::mt19937_64 rng(kSize);
+    std::uniform_real_distribution<double> spot(80, 120);
+    std::uniform_real_distribution<double> moneyness(0.7, 1.3);
+    std::uniform_real_distribution<double> time(0.02, 2.0);
+    std::uniform_real_distribution<double> rate(0.0, 0.05);
+    std::uniform_real_distribution<double> sigma(0.1, 0.6);
+    for (std::size_t i = 0; i < kSize; ++i) {
+      spot_.push_back(spot(rng));
+      strike_.push_back(spot_.back() * moneyness(rng));
+      time_.push_back(time(rng));
+      rate_.push_back(rate(rng));
+      sigma_.push_back(sigma(rng));
+      right_.push_back(i % 2 == 0 ? Right::kCall : Right::kPut);
+    }
+  }
+
+  [[nodiscard]] OptionBatch Batch() const {
+    return {spot_, strike_, time_, rate_, sigma_, right_};
+  }
+
+  std::vector<double> spot_, strike_, time_, rate_, sigma_;
+  std::vector<Right> right_;
+};
+
+#endif  // GOF23_BRIDGE_RANDOM_CHAIN_H
@@ -0,0 +1,97 @@
+#include "revaluation.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "bridge.h"
+#include "random_chain.h"
+
+namespace {
+
+constexpr std::size_t kBookSize = 1 << 18;
+
+struct Book {
+  Book() : chain_(kBookSize) {
+    for (std::size_t i = 0; i < kBookSize; ++i) {
+      options_.emplace_back(chain_.spot_[i], chain_.strike_[i],
+                            chain_.time_[i], chain_.rate_[i],
+                            chain_.sigma_[i], chain_.right_[i]);
+      options_.back().SetEngine(engine_);
+    }
+  }
+
+  std::shared_ptr<BlackScholesEngine> engine_ =
+      std::make_shared<BlackScholesEngine>();
+  RandomChain chain_;
+  std::vector<EuropeanOption> options_;
+};
+
+const Book& SharedBook() {
+  static const Book kBook;
+  return kBook;
+}
+
+void SetOptionsPerSecond(benchmark::State& state) {
+  state.counters["options/s"] =
+      benchmark::Counter(static_cast<double>(kBookSize),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// What there was before: EuropeanOption::Value, one option at a time.
+void BM_ValueLoop(benchmark::State& state) {
+  const Book& kBook = SharedBook();
+  std::vector<double> out(kBookSize);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kBookSize; ++i) {
+      out[i] = kBook.options_[i].Value();
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  SetOptionsPerSecond(state);
+}
+
+void BM_RevalueOptions(benchmark::State& state) {
+  const Book& kBook = SharedBook();
+  PortfolioRevaluer::Options options;
+  options.threads_ = static_cast<unsigned>(state.range(0));
+  PortfolioRevaluer revaluer(options);
+  std::vector<double> out(kBookSize);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        revaluer.Revalue(*kBook.engine_, kBook.options_, out));
+  }
+  SetOptionsPerSecond(state);
+}
+
+void BM_RevalueBatch(benchmark::State& state) {
+  const Book& kBook = SharedBook();
+  PortfolioRevaluer::Options options;
+  options.threads_ = static_cast<unsigned>(state.range(0));
+  PortfolioRevaluer revaluer(options);
+  std::vector<double> out(kBookSize);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        revaluer.Revalue(*kBook.engine_, kBook.chain_.Batch(), out));
+  }
+  SetOptionsPerSecond(state);
+}
+
+const int kMaxThreads =
+    static_cast<int>(std::max(1U, std::thread::hardware_concurrency()));
+
+}  // namespace
+
+BENCHMARK(BM_ValueLoop)->UseRealTime();
+BENCHMARK(BM_RevalueOptions)
+    ->DenseRange(1, kMaxThreads)
+    ->ArgName("threads")
+    ->UseRealTime();
+BENCHMARK(BM_RevalueBatch)
+    ->DenseRange(1, kMaxThreads)
+    ->ArgName("threads")
+    ->UseRealTime();
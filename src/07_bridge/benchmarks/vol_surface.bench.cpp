@@ -0,0 +1,85 @@
+#include "vol_surface.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "bridge.h"
+#include "random_chain.h"
+
+namespace {
+
+constexpr std::size_t kChainSize = 1 << 14;
+
+// 21 strikes across the chain's 56-156 strike range by 12 expiries out to
+// two years, with a smile that flattens with time.
+std::unique_ptr<VolSurface> MakeSurface(
+    const VolSurface::Interpolation kInterpolation) {
+  std::vector<double> strikes, expiries, vols;
+  for (int k = 0; k <= 20; ++k) strikes.push_back(50 + (5.5 * k));
+  for (int e = 1; e <= 12; ++e) expiries.push_back(e / 6.0);
+  for (const double kExpiry : expiries) {
+    for (const double kStrike : strikes) {
+      const double kMoneyness = (kStrike - 100) / 100;
+      vols.push_back(0.2 + (kMoneyness * kMoneyness / kExpiry));
+    }
+  }
+  return *VolSurface::Create(strikes, expiries, vols, kInterpolation);
+}
+
+VolSurface::Interpolation InterpolationOf(const benchmark::State& kState) {
+  return kState.range(0) == 0 ? VolSurface::Interpolation::kBilinear
+                              : VolSurface::Interpolation::kCubic;
+}
+
+void SetOptionsPerSecond(benchmark::State& state) {
+  state.counters["options/s"] =
+      benchmark::Counter(static_cast<double>(kChainSize),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_SigmaPerOption(benchmark::State& state) {
+  const auto kSurface = MakeSurface(InterpolationOf(state));
+  const RandomChain kChain(kChainSize);
+  std::vector<double> out(kChainSize);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kChainSize; ++i) {
+      out[i] = kSurface->Sigma(kChain.strike_[i], kChain.time_[i]);
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  SetOptionsPerSecond(state);
+}
+
+void BM_Lookup(benchmark::State& state) {
+  const auto kSurface = MakeSurface(InterpolationOf(state));
+  const RandomChain kChain(kChainSize);
+  std::vector<double> out(kChainSize);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        kSurface->Lookup(kChain.strike_, kChain.time_, out));
+  }
+  SetOptionsPerSecond(state);
+}
+
+// Lookup plus the batch kernel: the cost of pricing a chain off a surface
+// rather than a flat vol.
+void BM_PriceBatch(benchmark::State& state) {
+  const auto kSurface = MakeSurface(InterpolationOf(state));
+  const RandomChain kChain(kChainSize);
+  const BlackScholesEngine kEngine;
+  std::vector<double> out(kChainSize);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        kSurface->PriceBatch(kEngine, kChain.Batch(), out));
+  }
+  SetOptionsPerSecond(state);
+}
+
+}  // namespace
+
+BENCHMARK(BM_SigmaPerOption)->Arg(0)->Arg(1)->ArgName("cubic");
+BENCHMARK(BM_Lookup)->Arg(0)->Arg(1)->ArgName("cubic");
+BENCHMARK(BM_PriceBatch)->Arg(0)->Arg(1)->ArgName("cubic");
@@ -0,0 +1,114 @@
+#include "black_scholes_kernel.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+namespace {
+
+// The last partial block goes through the lanes too, padded out with copies
+// of its final option, so an option prices to the same bits wherever it
+// sits in a batch and however long the batch is. Callers comparing prices
+// from different batches, like OptionBook, rely on that.
+template <class V>
+void PriceLanes(const OptionBatch& kBatch, double* out) {
+  const std::size_t kSize = kBatch.Size();
+  std::size_t i = 0;
+  for (; i + V::kWidth <= kSize; i += V::kWidth) {
+    V::Store(out + i,
+             BlackScholesLanes<V>(V::Load(kBatch.spot_.data() + i),
+                                  V::Load(kBatch.strike_.data() + i),
+                                  V::Load(kBatch.time_.data() + i),
+                                  V::Load(kBatch.rate_.data() + i),
+                                  V::Load(kBatch.sigma_.data() + i),
+                                  V::LoadEq(kBatch.right_.data() + i,
+                                            Right::kCall)));
+  }
+  if (i == kSize) return;
+
+  std::array<double, V::kWidth> spot, strike, time, rate, sigma, price;
+  std::array<Right, V::kWidth> right;
+  for (std::size_t lane = 0; lane < V::kWidth; ++lane) {
+    const std::size_t kFrom = std::min(i + lane, kSize - 1);
+    spot[lane] = kBatch.spot_[kFrom];
+    strike[lane] = kBatch.strike_[kFrom];
+    time[lane] = kBatch.time_[kFrom];
+    rate[lane] = kBatch.rate_[kFrom];
+    sigma[lane] = kBatch.sigma_[kFrom];
+    right[lane] = kBatch.right_[kFrom];
+  }
+  V::Store(price.data(),
+           BlackScholesLanes<V>(V::Load(spot.data()), V::Load(strike.data()),
+                                V::Load(time.data()), V::Load(rate.data()),
+                                V::Load(sigma.data()),
+                                V::LoadEq(right.data(), Right::kCall)));
+  std::copy_n(price.begin(), kSize - i, out + i);
+}
+
+// Evaluating both CDF branches one lane at a time loses to libm, so
+// non-SIMD builds use the engine's own formula (called non-virtually).
+void PriceScalar(const OptionBatch& kBatch, const std::size_t kBegin,
+                 const std::size_t kEnd, double* out) {
+  const BlackScholesEngine kEngine;
+  for (std::size_t i = kBegin; i < kEnd; ++i) {
+    out[i] = kEngine.Price(kBatch.spot_[i], kBatch.strike_[i],
+                           kBatch.time_[i], kBatch.rate_[i], kBatch.sigma_[i],
+                           kBatch.right_[i]);
+  }
+}
+
+template <class V>
+void RiskLanes(const OptionBatch& kBatch, const std::size_t kEnd,
+               const GreeksBatch& kOut) {
+  for (std::size_t i = 0; i + V::kWidth <= kEnd; i += V::kWidth) {
+    const GreeksLanes<V> kGreeks = BlackScholesGreeksLanes<V>(
+        V::Load(kBatch.spot_.data() + i), V::Load(kBatch.strike_.data() + i),
+        V::Load(kBatch.time_.data() + i), V::Load(kBatch.rate_.data() + i),
+        V::Load(kBatch.sigma_.data() + i),
+        V::LoadEq(kBatch.right_.data() + i, Right::kCall));
+    V::Store(kOut.price_.data() + i, kGreeks.price_);
+    V::Store(kOut.delta_.data() + i, kGreeks.delta_);
+    V::Store(kOut.gamma_.data() + i, kGreeks.gamma_);
+    V::Store(kOut.vega_.data() + i, kGreeks.vega_);
+    V::Store(kOut.theta_.data() + i, kGreeks.theta_);
+    V::Store(kOut.rho_.data() + i, kGreeks.rho_);
+    V::Store(kOut.vanna_.data() + i, kGreeks.vanna_);
+    V::Store(kOut.volga_.data() + i, kGreeks.volga_);
+  }
+}
+
+void RiskScalar(const OptionBatch& kBatch, const std::size_t kBegin,
+                const std::size_t kEnd, const GreeksBatch& kOut) {
+  const BlackScholesEngine kEngine;
+  for (std::size_t i = kBegin; i < kEnd; ++i) {
+    kOut.Store(i, kEngine.Risk(kBatch.spot_[i], kBatch.strike_[i],
+                               kBatch.time_[i], kBatch.rate_[i],
+                               kBatch.sigma_[i], kBatch.right_[i]));
+  }
+}
+
+}  // namespace
+
+std::string_view BatchKernelIsa() { return NativeLanes::kName; }
+
+void BlackScholesBatchKernel(const OptionBatch& kBatch,
+                             std::span<double> out) {
+  if constexpr (NativeLanes::kWidth > 1) {
+    PriceLanes<NativeLanes>(kBatch, out.data());
+  } else {
+    PriceScalar(kBatch, 0, kBatch.Size(), out.data());
+  }
+}
+
+void BlackScholesGreeksKernel(const OptionBatch& kBatch,
+                              const GreeksBatch& kOut) {
+  const std::size_t kSize = kBatch.Size();
+  std::size_t vector_end = 0;
+  if constexpr (NativeLanes::kWidth > 1) {
+    vector_end = kSize - (kSize % NativeLanes::kWidth);
+    RiskLanes<NativeLanes>(kBatch, vector_end, kOut);
+  }
+  RiskScalar(kBatch, vector_end, kSize, kOut);
+}
@@ -0,0 +1,219 @@
+#ifndef GOF23_BLACK_SCHOLES_KERNEL_H
+#define GOF23_BLACK_SCHOLES_KERNEL_H
+
+#include <cstddef>
+#include <numbers>
+#include <span>
+#include <string_view>
+
+#include "../helpers/SimdLanes.h"
+#include "bridge.h"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+// Largest |batch - BlackScholesEngine::Price| the batched kernel may produce,
+// per unit of max(1, spot, strike). The gap comes from the Hart normal CDF
+// (~1e-15 absolute) replacing std::erfc in the SIMD lanes; non-SIMD builds
+// reuse Price and are exact. Either way an option's price does not depend
+// on where it sits in the batch.
+inline constexpr double kBatchPriceTolerance = 1e-13;
+
+// Bound on |batch - BlackScholesEngine::Risk| for every Greek, per unit of
+// max(1, |Greek|).
+inline constexpr double kBatchGreeksTolerance = 1e-11;
+
+// Name of the lane type BlackScholesBatchKernel was compiled for.
+[[nodiscard]] std::string_view BatchKernelIsa();
+
+// Prices every option in kBatch into out; sizes must already agree.
+void BlackScholesBatchKernel(const OptionBatch& kBatch, std::span<double> out);
+
+// Price and Greeks for every option in kBatch; sizes must already agree.
+void BlackScholesGreeksKernel(const OptionBatch& kBatch,
+                              const GreeksBatch& kOut);
+
+// Upper tail Q(|x|) of the standard normal (Hart 1968 via West 2005), so that
+// N(x) = x > 0 ? 1 - Q : Q with no cancellation in the far tail. kGauss is
+// exp(-x^2 / 2), which callers that also need the pdf already hold.
+template <class V>
+typename V::Reg NormalTail(const typename V::Reg kVal,
+                           const typename V::Reg kGauss) {
+  using Reg = typename V::Reg;
+  constexpr double kNum[] = {3.52624965998911e-02, 0.700383064443688,
+                             6.37396220353165,     33.912866078383,
+                             112.079291497871,     221.213596169931,
+                             220.206867912376};
+  constexpr double kDen[] = {8.83883476483184e-02, 1.75566716318264,
+                             16.064177579207,      86.7807322029461,
+                             296.564248779674,     637.333633378831,
+                             793.826512519948,     440.413735824752};
+  constexpr double kSplit = 7.07106781186547;
+  constexpr double kCutoff = 37.0;
+  constexpr double kSqrt2Pi = 2.506628274631;
+
+  const Reg kX = V::Min(V::Abs(kVal), V::Set1(kCutoff));
+  const Reg kRational = kGauss * Horner<V>(kX, kNum) / Horner<V>(kX, kDen);
+
+  Reg fraction = kX + V::Set1(0.65);
+  fraction = kX + V::Set1(4.0) / fraction;
+  fraction = kX + V::Set1(3.0) / fraction;
+  fraction = kX + V::Set1(2.0) / fraction;
+  fraction = kX + V::Set1(1.0) / fraction;
+  const Reg kContinued = kGauss / fraction / V::Set1(kSqrt2Pi);
+
+  const Reg kTail =
+      V::Select(V::Lt(kX, V::Set1(kSplit)), kRational, kContinued);
+  return V::Select(V::Lt(kX, V::Set1(kCutoff)), kTail, V::Set1(0.0));
+}
+
+// N(x) from the tail of |x|; also right for -x given the same kGauss.
+template <class V>
+typename V::Reg NormalCdf(const typename V::Reg kVal,
+                          const typename V::Reg kGauss) {
+  const typename V::Reg kTail = NormalTail<V>(kVal, kGauss);
+  return V::Select(V::Gt(kVal, V::Set1(0.0)), V::Set1(1.0) - kTail, kTail);
+}
+
+template <class V>
+typename V::Reg NormalCdf(const typename V::Reg kVal) {
+  return NormalCdf<V>(kVal, Exp<V>(V::Set1(-0.5) * kVal * kVal));
+}
+
+// The terms every Black-Scholes quantity is built from, for one register of
+// options. Lanes with time or sigma <= 0 are flagged expired and lanes with
+// a zero spot or strike degenerate; both get safe placeholder inputs so the
+// model math stays finite and is later replaced with the limiting value.
+template <class V>
+struct BlackScholesTerms {
+  using Reg = typename V::Reg;
+  using Mask = typename V::Mask;
+
+  BlackScholesTerms(const Reg kSpot, const Reg kStrike, const Reg kTime,
+                    const Reg kRate, const Reg kSigma, const Mask kIsCall) {
+    const Reg kZero = V::Set1(0.0);
+    const Reg kOne = V::Set1(1.0);
+    expired_ = V::Or(V::Le(kTime, kZero), V::Le(kSigma, kZero));
+    degenerate_ = V::Or(V::Le(kSpot, kZero), V::Le(kStrike, kZero));
+
+    const Reg kT = V::Select(expired_, kOne, kTime);
+    vol_ = V::Select(expired_, kOne, kSigma);
+    sqrt_t_ = V::Sqrt(kT);
+    const Reg kMoneyness = V::Select(degenerate_, kOne, kSpot / kStrike);
+    const Reg kVolSqrtT = vol_ * sqrt_t_;
+    d1_ = (Log<V>(kMoneyness) + (kRate + V::Set1(0.5) * vol_ * vol_) * kT) /
+          kVolSqrtT;
+    d2_ = d1_ - kVolSqrtT;
+    strike_disc_ = kStrike * Exp<V>(-kRate * kTime);
+    sign_ = V::Select(kIsCall, kOne, V::Set1(-1.0));
+  }
+
+  Mask expired_;
+  Mask degenerate_;
+  Reg vol_;
+  Reg sqrt_t_;
+  Reg d1_;
+  Reg d2_;
+  Reg strike_disc_;  // K e^{-rT}
+  Reg sign_;         // +1 call, -1 put
+};
+
+// Black-Scholes price over one register of options. Expired lanes return
+// intrinsic value, matching the scalar engine; degenerate lanes return the
+// discounted intrinsic value, the model's limit there.
+template <class V>
+typename V::Reg BlackScholesLanes(const typename V::Reg kSpot,
+                                  const typename V::Reg kStrike,
+                                  const typename V::Reg kTime,
+                                  const typename V::Reg kRate,
+                                  const typename V::Reg kSigma,
+                                  const typename V::Mask kIsCall) {
+  using Reg = typename V::Reg;
+  const BlackScholesTerms<V> kTerms(kSpot, kStrike, kTime, kRate, kSigma,
+                                    kIsCall);
+  const Reg kZero = V::Set1(0.0);
+  const Reg kSign = kTerms.sign_;
+
+  // Calls and puts share one formula: sign * (S N(sign d1) - K D N(sign d2)).
+  const Reg kModel =
+      kSign * (kSpot * NormalCdf<V>(kSign * kTerms.d1_) -
+               kTerms.strike_disc_ * NormalCdf<V>(kSign * kTerms.d2_));
+  const Reg kIntrinsic = V::Max(kZero, kSign * (kSpot - kStrike));
+  const Reg kForward = V::Max(kZero, kSign * (kSpot - kTerms.strike_disc_));
+
+  return V::Select(kTerms.expired_, kIntrinsic,
+                   V::Select(kTerms.degenerate_, kForward, kModel));
+}
+
+template <class V>
+struct GreeksLanes {
+  typename V::Reg price_, delta_, gamma_, vega_, theta_, rho_, vanna_, volga_;
+};
+
+// Price and Greeks over one register from a single d1/d2, discount factor
+// and exp(-d1^2 / 2), which serves as both the pdf and the CDFs' Gaussian.
+// Expired and degenerate lanes follow BlackScholesEngine::Risk.
+template <class V>
+GreeksLanes<V> BlackScholesGreeksLanes(const typename V::Reg kSpot,
+                                       const typename V::Reg kStrike,
+                                       const typename V::Reg kTime,
+                                       const typename V::Reg kRate,
+                                       const typename V::Reg kSigma,
+                                       const typename V::Mask kIsCall) {
+  using Reg = typename V::Reg;
+  constexpr double kInvSqrt2Pi =
+      std::numbers::inv_sqrtpi / std::numbers::sqrt2;
+  const BlackScholesTerms<V> kTerms(kSpot, kStrike, kTime, kRate, kSigma,
+                                    kIsCall);
+  const Reg kZero = V::Set1(0.0);
+  const Reg kSign = kTerms.sign_;
+  const Reg kKd = kTerms.strike_disc_;
+
+  // S n(d1) = K e^{-rT} n(d2), so d2's Gaussian needs no second exp.
+  const Reg kGauss1 = Exp<V>(V::Set1(-0.5) * kTerms.d1_ * kTerms.d1_);
+  const Reg kGauss2 = kGauss1 * kSpot / kKd;
+  const Reg kPdf = kGauss1 * V::Set1(kInvSqrt2Pi);
+  const Reg kNd1 = NormalCdf<V>(kSign * kTerms.d1_, kGauss1);
+  const Reg kNd2 = NormalCdf<V>(kSign * kTerms.d2_, kGauss2);
+
+  GreeksLanes<V> model;
+  model.price_ = kSign * (kSpot * kNd1 - kKd * kNd2);
+  model.delta_ = kSign * kNd1;
+  model.gamma_ = kPdf / (kSpot * kTerms.vol_ * kTerms.sqrt_t_);
+  model.vega_ = kSpot * kPdf * kTerms.sqrt_t_;
+  model.theta_ =
+      -kSpot * kPdf * kTerms.vol_ / (V::Set1(2.0) * kTerms.sqrt_t_) -
+      kSign * kRate * kKd * kNd2;
+  model.rho_ = kSign * kTime * kKd * kNd2;
+  model.vanna_ = -kPdf * kTerms.d2_ / kTerms.vol_;
+  model.volga_ = model.vega_ * kTerms.d1_ * kTerms.d2_ / kTerms.vol_;
+
+  // Outside the model the option is a linear payoff in spot: the intrinsic
+  // value when expired, the forward (with its rate and time terms) when
+  // degenerate.
+  const auto kFlat = V::Or(kTerms.expired_, kTerms.degenerate_);
+  const Reg kForward = kSign * (kSpot - kKd);
+  const Reg kIntrinsic = kSign * (kSpot - kStrike);
+  const Reg kPayoff = V::Select(kTerms.expired_, kIntrinsic, kForward);
+  const auto kInTheMoney = V::Gt(kPayoff, kZero);
+  const auto kCarry = V::AndNot(V::Gt(kForward, kZero), kTerms.expired_);
+
+  GreeksLanes<V> out;
+  out.price_ = V::Select(kFlat, V::Max(kZero, kPayoff), model.price_);
+  out.delta_ = V::Select(kFlat, V::Select(kInTheMoney, kSign, kZero),
+                         model.delta_);
+  out.gamma_ = V::Select(kFlat, kZero, model.gamma_);
+  out.vega_ = V::Select(kFlat, kZero, model.vega_);
+  out.theta_ = V::Select(
+      kFlat, V::Select(kCarry, -kSign * kRate * kKd, kZero),
+      model.theta_);
+  out.rho_ = V::Select(
+      kFlat, V::Select(kCarry, kSign * kTime * kKd, kZero),
+      model.rho_);
+  out.vanna_ = V::Select(kFlat, kZero, model.vanna_);
+  out.volga_ = V::Select(kFlat, kZero, model.volga_);
+  return out;
+}
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_BLACK_SCHOLES_KERNEL_H
@@ -10,19 +10,145 @@
 #include <memory>
 #include <numbers>
 
-double BlackScholesEngine::NormalCDF(const double kVal) {
-  constexpr double kHalf = 0.5;
-  return kHalf * std::erfc(-kVal / std::numbers::sqrt2);
+#include "black_scholes_kernel.h"
+
+std::size_t OptionBatch::Size() const { return spot_.size(); }
+
+absl::Status OptionBatch::Validate(const std::size_t kOutSize) const {
+  const std::size_t kSize = Size();
+  if (strike_.size() != kSize || time_.size() != kSize ||
+      rate_.size() != kSize || sigma_.size() != kSize ||
+      right_.size() != kSize) {
+    return absl::InvalidArgumentError("option batch spans differ in length");
+  }
+  if (kOutSize != kSize) {
+    return absl::InvalidArgumentError("output span does not match batch size");
+  }
+  return absl::OkStatus();
+}
+
+absl::Status GreeksBatch::Validate(const OptionBatch& kBatch) const {
+  if (auto status = kBatch.Validate(price_.size()); !status.ok()) {
+    return status;
+  }
+  const std::size_t kSize = price_.size();
+  if (delta_.size() != kSize || gamma_.size() != kSize ||
+      vega_.size() != kSize || theta_.size() != kSize ||
+      rho_.size() != kSize || vanna_.size() != kSize ||
+      volga_.size() != kSize) {
+    return absl::InvalidArgumentError("greeks spans differ in length");
+  }
+  return absl::OkStatus();
+}
+
+void GreeksBatch::Store(const std::size_t kIndex, const Greeks& kGreeks) const {
+  price_[kIndex] = kGreeks.price_;
+  delta_[kIndex] = kGreeks.delta_;
+  gamma_[kIndex] = kGreeks.gamma_;
+  vega_[kIndex] = kGreeks.vega_;
+  theta_[kIndex] = kGreeks.theta_;
+  rho_[kIndex] = kGreeks.rho_;
+  vanna_[kIndex] = kGreeks.vanna_;
+  volga_[kIndex] = kGreeks.volga_;
+}
+
+absl::Status PriceEngine::PriceBatch(const OptionBatch& kBatch,
+                                     std::span<double> out) const {
+  if (auto status = kBatch.Validate(out.size()); !status.ok()) return status;
+  for (std::size_t i = 0; i < kBatch.Size(); ++i) {
+    out[i] = Price(kBatch.spot_[i], kBatch.strike_[i], kBatch.time_[i],
+                   kBatch.rate_[i], kBatch.sigma_[i], kBatch.right_[i]);
+  }
+  return absl::OkStatus();
+}
+
+// NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+Greeks PriceEngine::Risk(const double kSpot, const double kStrike,
+                         const double kTime, const double kRate,
+                         const double kSigma, const Right kRight) const {
+  const double kHs = 1e-3 * std::max(kSpot, 1.0);
+  const double kHv = 1e-3;
+  const double kHr = 1e-4;
+  const double kHt = std::min(1e-4, 0.5 * kTime);
+
+  const auto kValue = [&](const double kS, const double kT, const double kR,
+                          const double kV) {
+    return Price(kS, kStrike, kT, kR, kV, kRight);
+  };
+
+  Greeks greeks;
+  greeks.price_ = kValue(kSpot, kTime, kRate, kSigma);
+
+  const double kSpotUp = kValue(kSpot + kHs, kTime, kRate, kSigma);
+  const double kSpotDown = kValue(kSpot - kHs, kTime, kRate, kSigma);
+  greeks.delta_ = (kSpotUp - kSpotDown) / (2 * kHs);
+  greeks.gamma_ = (kSpotUp - 2 * greeks.price_ + kSpotDown) / (kHs * kHs);
+
+  const double kVolUp = kValue(kSpot, kTime, kRate, kSigma + kHv);
+  const double kVolDown = kValue(kSpot, kTime, kRate, kSigma - kHv);
+  greeks.vega_ = (kVolUp - kVolDown) / (2 * kHv);
+  greeks.volga_ = (kVolUp - 2 * greeks.price_ + kVolDown) / (kHv * kHv);
+
+  if (kHt > 0) {
+    greeks.theta_ = -(kValue(kSpot, kTime + kHt, kRate, kSigma) -
+                      kValue(kSpot, kTime - kHt, kRate, kSigma)) /
+                    (2 * kHt);
+  }
+  greeks.rho_ = (kValue(kSpot, kTime, kRate + kHr, kSigma) -
+                 kValue(kSpot, kTime, kRate - kHr, kSigma)) /
+                (2 * kHr);
+  greeks.vanna_ = (kValue(kSpot + kHs, kTime, kRate, kSigma + kHv) -
+                   kValue(kSpot + kHs, kTime, kRate, kSigma - kHv) -
+                   kValue(kSpot - kHs, kTime, kRate, kSigma + kHv) +
+                   kValue(kSpot - kHs, kTime, kRate, kSigma - kHv)) /
+                  (4 * kHs * kHv);
+  return greeks;
+}
+
+absl::Status PriceEngine::RiskBatch(const OptionBatch& kBatch,
+                                    const GreeksBatch& kOut) const {
+  if (auto status = kOut.Validate(kBatch); !status.ok()) return status;
+  for (std::size_t i = 0; i < kBatch.Size(); ++i) {
+    kOut.Store(i, Risk(kBatch.spot_[i], kBatch.strike_[i], kBatch.time_[i],
+                       kBatch.rate_[i], kBatch.sigma_[i], kBatch.right_[i]));
+  }
+  return absl::OkStatus();
+}
+
+absl::Status BlackScholesEngine::PriceBatch(const OptionBatch& kBatch,
+                                            std::span<double> out) const {
+  if (auto status = kBatch.Validate(out.size()); !status.ok()) return status;
+  BlackScholesBatchKernel(kBatch, out);
+  return absl::OkStatus();
 }
 
 // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
-double BlackScholesEngine::Price(const double kSpot, const double kStrike,
-                                 const double kTime, const double kRate,
-                                 const double kSigma,
-                                 const Right kRight) const {
+Greeks BlackScholesEngine::Risk(const double kSpot, const double kStrike,
+                                const double kTime, const double kRate,
+                                const double kSigma, const Right kRight) const {
+  const double kSign = kRight == Right::kCall ? 1.0 : -1.0;
+  Greeks greeks;
+
+  // No time value left: the option is its payoff, linear in spot.
   if (kTime <= 0 || kSigma <= 0) {
-    return kRight == Right::kCall ? std::max(0.0, kSpot - kStrike)
-                                  : std::max(0.0, kStrike - kSpot);
+    greeks.price_ = Price(kSpot, kStrike, kTime, kRate, kSigma, kRight);
+    greeks.delta_ = kSign * (kSpot - kStrike) > 0 ? kSign : 0.0;
+    return greeks;
+  }
+
+  const double kDisc = std::exp(-kRate * kTime);
+  const double kStrikeDisc = kStrike * kDisc;
+
+  // A zero spot or strike pins d1 at +-inf; the price is the forward payoff.
+  if (kSpot <= 0 || kStrike <= 0) {
+    const double kForward = kSign * (kSpot - kStrikeDisc);
+    if (kForward > 0) {
+      greeks.price_ = kForward;
+      greeks.delta_ = kSign;
+      greeks.theta_ = -kSign * kRate * kStrikeDisc;
+      greeks.rho_ = kSign * kTime * kStrikeDisc;
+    }
+    return greeks;
   }
 
   const double kSqrtT = std::sqrt(kTime);
@@ -33,23 +159,29 @@ double BlackScholesEngine::Price(const double kSpot, const double kStrike,
 
   const double kD2 = kD1 - (kSigma * kSqrtT);
 
-  const double kDisc = std::exp(-kRate * kTime);
+  const double kPdf = std::exp(-0.5 * kD1 * kD1) * std::numbers::inv_sqrtpi /
+                      std::numbers::sqrt2;
+  const double kNd1 = NormalCDF(kSign * kD1);
+  const double kNd2 = NormalCDF(kSign * kD2);
 
-  if (kRight == Right::kCall) {
-    return (kSpot * NormalCDF(kD1)) - (kStrike * kDisc * NormalCDF(kD2));
-  }
-  return (kStrike * kDisc * NormalCDF(-kD2)) - (kSpot * NormalCDF(-kD1));
+  greeks.price_ = kSign * ((kSpot * kNd1) - (kStrikeDisc * kNd2));
+  greeks.delta_ = kSign * kNd1;
+  greeks.gamma_ = kPdf / (kSpot * kSigma * kSqrtT);
+  greeks.vega_ = kSpot * kPdf * kSqrtT;
+  greeks.theta_ = (-kSpot * kPdf * kSigma / (2 * kSqrtT)) -
+                  (kSign * kRate * kStrikeDisc * kNd2);
+  greeks.rho_ = kSign * kTime * kStrikeDisc * kNd2;
+  greeks.vanna_ = -kPdf * kD2 / kSigma;
+  greeks.volga_ = greeks.vega_ * kD1 * kD2 / kSigma;
+  return greeks;
 }
 
-// NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
-double DummyEngine::Price(const double kSpot, const double kStrike,
-                          [[maybe_unused]] const double kTime,
-                          [[maybe_unused]] const double kRate,
-                          [[maybe_unused]] const double kSigma,
-                          const Right kRight) const {
-  return std::max(
-      0.0, kRight == Right::kCall ? (kSpot - kStrike) : (kStrike - kSpot));
-};
+absl::Status BlackScholesEngine::RiskBatch(const OptionBatch& kBatch,
+                                           const GreeksBatch& kOut) const {
+  if (auto status = kOut.Validate(kBatch); !status.ok()) return status;
+  BlackScholesGreeksKernel(kBatch, kOut);
+  return absl::OkStatus();
+}
 
 // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
 EuropeanOption::EuropeanOption(const double kSpot, const double kStrike,
@@ -66,6 +198,10 @@ double EuropeanOption::Value() const {
   return engine_->Price(spot_, strike_, time_, rate_, sigma_, right_);
 }
 
+Greeks EuropeanOption::Risk() const {
+  return engine_->Risk(spot_, strike_, time_, rate_, sigma_, right_);
+}
+
 void Option::SetEngine(std::shared_ptr<PriceEngine> engine) {
   engine_ = std::move(engine);
 }
\ No newline at end of file
@@ -5,17 +5,82 @@
 #ifndef GOF23_BRIDGE_H
 #define GOF23_BRIDGE_H
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <numbers>
+#include <span>
+
+#include <absl/status/status.h>
 
 // NOLINTBEGIN(readability-identifier-naming)
 
 enum class Right : uint8_t { kCall, kPut };
 
+// Structure-of-arrays view over a batch of options; element i of every span
+// describes the same option.
+struct OptionBatch {
+  std::span<const double> spot_;
+  std::span<const double> strike_;
+  std::span<const double> time_;
+  std::span<const double> rate_;
+  std::span<const double> sigma_;
+  std::span<const Right> right_;
+
+  [[nodiscard]] std::size_t Size() const;
+  [[nodiscard]] absl::Status Validate(std::size_t kOutSize) const;
+};
+
+// Price and sensitivities per unit move: vega per 1.00 of vol, rho per 1.00
+// of rate, theta per year of calendar time (dV/dt = -dV/dT).
+struct Greeks {
+  double price_{};
+  double delta_{};
+  double gamma_{};
+  double vega_{};
+  double theta_{};
+  double rho_{};
+  double vanna_{};  // d(delta)/d(sigma)
+  double volga_{};  // d(vega)/d(sigma)
+};
+
+// Structure-of-arrays output for Greeks; every span must match the batch.
+struct GreeksBatch {
+  std::span<double> price_;
+  std::span<double> delta_;
+  std::span<double> gamma_;
+  std::span<double> vega_;
+  std::span<double> theta_;
+  std::span<double> rho_;
+  std::span<double> vanna_;
+  std::span<double> volga_;
+
+  [[nodiscard]] absl::Status Validate(const OptionBatch& kBatch) const;
+  void Store(std::size_t kIndex, const Greeks& kGreeks) const;
+};
+
 struct PriceEngine {
   virtual ~PriceEngine() = default;
   [[nodiscard]] virtual double Price(double kSpot, double kStrike, double kTime,
                                      double kRate, double kSigma,
                                      Right kRight) const = 0;
+
+  // Writes the price of option i into out[i]. The default calls Price once
+  // per option; engines with a vectorised kernel override it.
+  virtual absl::Status PriceBatch(const OptionBatch& kBatch,
+                                  std::span<double> out) const;
+
+  // Price plus Greeks. The default bumps and reprices through Price (13
+  // calls); engines with closed forms override it with a single pass.
+  [[nodiscard]] virtual Greeks Risk(double kSpot, double kStrike, double kTime,
+                                    double kRate, double kSigma,
+                                    Right kRight) const;
+
+  // Batched Risk; the default calls Risk once per option.
+  virtual absl::Status RiskBatch(const OptionBatch& kBatch,
+                                 const GreeksBatch& kOut) const;
 };
 
 struct BlackScholesEngine final : PriceEngine {
@@ -24,6 +89,18 @@ struct BlackScholesEngine final : PriceEngine {
   [[nodiscard]] double Price(double kSpot, double kStrike, double kTime,
                              double kRate, double kSigma,
                              Right kRight) const override;
+
+  // Vectorised; agrees with Price to within kBatchPriceTolerance.
+  absl::Status PriceBatch(const OptionBatch& kBatch,
+                          std::span<double> out) const override;
+
+  // Closed form sharing one d1, d2, discount factor and N/n evaluation.
+  [[nodiscard]] Greeks Risk(double kSpot, double kStrike, double kTime,
+                            double kRate, double kSigma,
+                            Right kRight) const override;
+
+  absl::Status RiskBatch(const OptionBatch& kBatch,
+                         const GreeksBatch& kOut) const override;
 };
 
 struct DummyEngine final : PriceEngine {
@@ -32,10 +109,111 @@ struct DummyEngine final : PriceEngine {
                              Right kRight) const override;
 };
 
+enum class Exercise : uint8_t { kEuropean, kAmerican };
+
+// Backward induction on a recombining tree (Cox-Ross-Rubinstein binomial or
+// Boyle trinomial), the first engine able to price early exercise. Values
+// roll through a single buffer of steps + 1 (binomial) or 2 * steps + 1
+// (trinomial) nodes, so even 2000 steps stays cache resident. The binomial
+// tree assumes sigma * sqrt(dt) > |rate| * dt, i.e. a risk-neutral
+// probability inside (0, 1).
+struct LatticeEngine final : PriceEngine {
+  enum class Tree : uint8_t { kBinomial, kTrinomial };
+
+  explicit LatticeEngine(int kSteps = 1000, Tree kTree = Tree::kBinomial,
+                         Exercise kExercise = Exercise::kAmerican);
+
+  [[nodiscard]] double Price(double kSpot, double kStrike, double kTime,
+                             double kRate, double kSigma,
+                             Right kRight) const override;
+
+  // Runs of consecutive options sharing spot, time, rate and sigma (a chain
+  // sorted by underlying and expiry) are priced with one PriceSweep each.
+  absl::Status PriceBatch(const OptionBatch& kBatch,
+                          std::span<double> out) const override;
+
+  // Prices every strike/right pair on one underlying in a single backward
+  // sweep: the node spots and discounting are shared and the per-node work
+  // runs across options, several at a time.
+  absl::Status PriceSweep(double kSpot, double kTime, double kRate,
+                          double kSigma, std::span<const double> strikes,
+                          std::span<const Right> rights,
+                          std::span<double> out) const;
+
+  int steps_;
+  Tree tree_;
+  Exercise exercise_;
+};
+
+// Undiscounted payoff of one simulated path; kPath holds the spot at every
+// monitoring date, expiry last.
+struct Payoff {
+  virtual ~Payoff() = default;
+  [[nodiscard]] virtual double Value(std::span<const double> kPath,
+                                     double kStrike, Right kRight) const = 0;
+};
+
+struct VanillaPayoff final : Payoff {
+  [[nodiscard]] double Value(std::span<const double> kPath, double kStrike,
+                             Right kRight) const override;
+};
+
+// Arithmetic average of the spot over every monitoring date against the
+// strike.
+struct AsianPayoff final : Payoff {
+  [[nodiscard]] double Value(std::span<const double> kPath, double kStrike,
+                             Right kRight) const override;
+};
+
+// Simulates geometric Brownian paths on a WorkStealingPool that the engine
+// starts once and keeps, so small pricings pay no thread start-up. Path i
+// draws its normals from Philox keyed on the seed at counter (i, draw), and
+// paths are reduced in fixed-size blocks in block order, so an estimate is
+// bit-identical whatever the thread count.
+struct MonteCarloEngine final : PriceEngine {
+  struct Options {
+    std::uint64_t paths_ = 1 << 18;  // both legs of a pair count as paths
+    int steps_ = 1;                  // monitoring dates per path
+    unsigned threads_ = 0;           // 0: std::thread::hardware_concurrency
+    std::uint64_t seed_ = 0;
+    bool antithetic_ = true;
+    bool control_variate_ = true;  // the vanilla payoff, priced exactly by
+                                   // Black-Scholes, with a fitted beta
+    std::shared_ptr<const Payoff> payoff_;  // null: VanillaPayoff
+  };
+
+  struct Estimate {
+    double price_{};
+    double std_error_{};
+  };
+
+  MonteCarloEngine();
+  explicit MonteCarloEngine(Options options);
+  ~MonteCarloEngine() override;
+
+  [[nodiscard]] double Price(double kSpot, double kStrike, double kTime,
+                             double kRate, double kSigma,
+                             Right kRight) const override;
+
+  // Price with its standard error. Expired or zero-vol options return the
+  // intrinsic value with no error, like the other engines.
+  [[nodiscard]] Estimate Simulate(double kSpot, double kStrike, double kTime,
+                                  double kRate, double kSigma,
+                                  Right kRight) const;
+
+  Options options_;  // threads_ is read once, when the engine is built
+
+ private:
+  // Worker threads started with the engine and shared by every Simulate.
+  struct Workers;
+  std::unique_ptr<Workers> workers_;
+};
+
 struct Option {
   virtual ~Option() = default;
   void SetEngine(std::shared_ptr<PriceEngine> engine);
   [[nodiscard]] virtual double Value() const = 0;
+  [[nodiscard]] virtual Greeks Risk() const = 0;
 
  protected:
   std::shared_ptr<PriceEngine> engine_;
@@ -45,10 +223,57 @@ struct EuropeanOption final : Option {
   explicit EuropeanOption(double kSpot, double kStrike, double kTime,
                           double kRate, double kSigma, Right kRight);
   [[nodiscard]] double Value() const override;
+  [[nodiscard]] Greeks Risk() const override;
 
   double spot_, strike_, time_, rate_, sigma_;
   Right right_;
 };
+
+// The closed-form engines are defined inline so callers that bind them by
+// type (BasicEuropeanOption) can inline the whole price.
+
+inline double BlackScholesEngine::NormalCDF(const double kVal) {
+  constexpr double kHalf = 0.5;
+  return kHalf * std::erfc(-kVal / std::numbers::sqrt2);
+}
+
+// NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+inline double BlackScholesEngine::Price(const double kSpot,
+                                        const double kStrike,
+                                        const double kTime, const double kRate,
+                                        const double kSigma,
+                                        const Right kRight) const {
+  if (kTime <= 0 || kSigma <= 0) {
+    return kRight == Right::kCall ? std::max(0.0, kSpot - kStrike)
+                                  : std::max(0.0, kStrike - kSpot);
+  }
+
+  const double kSqrtT = std::sqrt(kTime);
+
+  const double kD1 =
+      (std::log(kSpot / kStrike) + (kRate + 0.5 * kSigma * kSigma) * kTime) /
+      (kSigma * kSqrtT);
+
+  const double kD2 = kD1 - (kSigma * kSqrtT);
+
+  const double kDisc = std::exp(-kRate * kTime);
+
+  if (kRight == Right::kCall) {
+    return (kSpot * NormalCDF(kD1)) - (kStrike * kDisc * NormalCDF(kD2));
+  }
+  return (kStrike * kDisc * NormalCDF(-kD2)) - (kSpot * NormalCDF(-kD1));
+}
+
+// NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+inline double DummyEngine::Price(const double kSpot, const double kStrike,
+                                 [[maybe_unused]] const double kTime,
+                                 [[maybe_unused]] const double kRate,
+                                 [[maybe_unused]] const double kSigma,
+                                 const Right kRight) const {
+  return std::max(
+      0.0, kRight == Right::kCall ? (kSpot - kStrike) : (kStrike - kSpot));
+}
+
 // NOLINTEND(readability-identifier-naming)
 
 #endif  // GOF23_BRIDGE_H
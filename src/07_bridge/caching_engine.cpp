@@ -0,0 +1,142 @@
+#include "caching_engine.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace {
+
+using Key = std::array<std::int64_t, 6>;
+
+// Snaps kValue to the nearest whole number of ticks, halves away from zero
+// like std::round but without the libm call; false for NaN, inf or a tick
+// count that would not fit the key.
+bool Snap(const double kValue, const double kInverseTick,
+          std::int64_t& ticks) {
+  const double kTicks = kValue * kInverseTick;
+  if (!(std::fabs(kTicks) < 0x1p62)) return false;
+  ticks = static_cast<std::int64_t>(kTicks);
+  const double kRest = kTicks - static_cast<double>(ticks);
+  ticks += static_cast<std::int64_t>(kRest >= 0.5) -
+           static_cast<std::int64_t>(kRest <= -0.5);
+  return true;
+}
+
+// Multiply-xorshift over the key words; six words are too few to be worth
+// a general-purpose hash call on every lookup.
+std::uint64_t Mix(const Key& kKey) {
+  std::uint64_t hash = 0;
+  for (const std::int64_t kWord : kKey) {
+    hash = (hash ^ static_cast<std::uint64_t>(kWord)) * 0x9E3779B97F4A7C15;
+    hash ^= hash >> 29;
+  }
+  return hash ^ (hash >> 32);
+}
+
+}  // namespace
+
+CachingEngine::CachingEngine(std::shared_ptr<const PriceEngine> inner)
+    : CachingEngine(std::move(inner), Options{}) {}
+
+CachingEngine::CachingEngine(std::shared_ptr<const PriceEngine> inner,
+                             const Options options)
+    : inner_(std::move(inner)),
+      options_(options),
+      slot_count_(std::bit_ceil(std::max(options.capacity_, kProbeLimit))),
+      inverse_tick_{1 / options.spot_tick_, 1 / options.strike_tick_,
+                    1 / options.time_tick_, 1 / options.rate_tick_,
+                    1 / options.sigma_tick_},
+      slots_(std::make_unique<Slot[]>(slot_count_)),
+      counters_(std::make_unique<Counters[]>(kCounterStripes)) {}
+
+// NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+double CachingEngine::Price(const double kSpot, const double kStrike,
+                            const double kTime, const double kRate,
+                            const double kSigma, const Right kRight) const {
+  Key key{};
+  if (!Snap(kSpot, inverse_tick_[0], key[0]) ||
+      !Snap(kStrike, inverse_tick_[1], key[1]) ||
+      !Snap(kTime, inverse_tick_[2], key[2]) ||
+      !Snap(kRate, inverse_tick_[3], key[3]) ||
+      !Snap(kSigma, inverse_tick_[4], key[4])) {
+    ThreadCounters().misses_.fetch_add(1, std::memory_order_relaxed);
+    return inner_->Price(kSpot, kStrike, kTime, kRate, kSigma, kRight);
+  }
+  key[5] = static_cast<std::int64_t>(kRight);
+
+  const std::size_t kHash = Mix(key);
+  const std::size_t kMask = slot_count_ - 1;
+  const auto kSlotAt = [&](const std::size_t kProbe) -> Slot& {
+    return slots_[(kHash + kProbe) & kMask];
+  };
+
+  for (std::size_t probe = 0; probe < kProbeLimit; ++probe) {
+    const Slot& kSlot = kSlotAt(probe);
+    const std::uint64_t kVersion =
+        kSlot.version_.load(std::memory_order_acquire);
+    if (kVersion == 0 || (kVersion & 1) != 0) continue;
+    bool match = true;
+    for (int i = 0; i < kKeyWords; ++i) {
+      match &= kSlot.key_[i].load(std::memory_order_relaxed) == key[i];
+    }
+    const double kValue = kSlot.value_.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (match && kSlot.version_.load(std::memory_order_relaxed) == kVersion) {
+      ThreadCounters().hits_.fetch_add(1, std::memory_order_relaxed);
+      return kValue;
+    }
+  }
+
+  ThreadCounters().misses_.fetch_add(1, std::memory_order_relaxed);
+  const double kValue = inner_->Price(
+      static_cast<double>(key[0]) * options_.spot_tick_,
+      static_cast<double>(key[1]) * options_.strike_tick_,
+      static_cast<double>(key[2]) * options_.time_tick_,
+      static_cast<double>(key[3]) * options_.rate_tick_,
+      static_cast<double>(key[4]) * options_.sigma_tick_, kRight);
+
+  // First empty slot in the window, else a victim picked by the hash's top
+  // bits. A slot another thread is writing is left alone: the value is
+  // returned uncached rather than waiting.
+  Slot* target = &kSlotAt((kHash >> 32) % kProbeLimit);
+  for (std::size_t probe = 0; probe < kProbeLimit; ++probe) {
+    if (kSlotAt(probe).version_.load(std::memory_order_relaxed) == 0) {
+      target = &kSlotAt(probe);
+      break;
+    }
+  }
+  std::uint64_t version = target->version_.load(std::memory_order_relaxed);
+  if ((version & 1) == 0 &&
+      target->version_.compare_exchange_strong(version, version + 1,
+                                               std::memory_order_acquire)) {
+    std::atomic_thread_fence(std::memory_order_release);
+    for (int i = 0; i < kKeyWords; ++i) {
+      target->key_[i].store(key[i], std::memory_order_relaxed);
+    }
+    target->value_.store(kValue, std::memory_order_relaxed);
+    target->version_.store(version + 2, std::memory_order_release);
+  }
+  return kValue;
+}
+
+CachingEngine::Stats CachingEngine::GetStats() const {
+  Stats stats;
+  for (std::size_t i = 0; i < kCounterStripes; ++i) {
+    stats.hits_ += counters_[i].hits_.load(std::memory_order_relaxed);
+    stats.misses_ += counters_[i].misses_.load(std::memory_order_relaxed);
+  }
+  return stats;
+}
+
+CachingEngine::Counters& CachingEngine::ThreadCounters() const {
+  static std::atomic<std::size_t> next_stripe{0};
+  thread_local const std::size_t kStripe =
+      next_stripe.fetch_add(1, std::memory_order_relaxed) % kCounterStripes;
+  return counters_[kStripe];
+}
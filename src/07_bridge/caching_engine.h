@@ -0,0 +1,77 @@
+#ifndef GOF23_CACHING_ENGINE_H
+#define GOF23_CACHING_ENGINE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "bridge.h"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+// Memoizing PriceEngine decorator. Inputs are snapped to a grid of ticks and
+// the inner engine prices the snapped point, so any inputs within half a
+// tick share one entry and a cached value never depends on which caller got
+// there first. Entries live in a fixed power-of-two open-addressing table:
+// memory is bounded up front and a full probe window evicts.
+//
+// Price is safe to call from any number of threads at once. Each slot is a
+// seqlock: readers never block, and a reader that races a writer just takes
+// the miss path.
+class CachingEngine final : public PriceEngine {
+ public:
+  struct Options {
+    std::size_t capacity_ = 1 << 16;  // slots, rounded up to a power of two
+    double spot_tick_ = 1e-4;
+    double strike_tick_ = 1e-4;
+    double time_tick_ = 1e-6;  // ~30 seconds of a year
+    double rate_tick_ = 1e-6;
+    double sigma_tick_ = 1e-6;
+  };
+
+  struct Stats {
+    std::uint64_t hits_{};
+    std::uint64_t misses_{};  // including inputs too large to snap
+  };
+
+  explicit CachingEngine(std::shared_ptr<const PriceEngine> inner);
+  CachingEngine(std::shared_ptr<const PriceEngine> inner, Options options);
+
+  [[nodiscard]] double Price(double kSpot, double kStrike, double kTime,
+                             double kRate, double kSigma,
+                             Right kRight) const override;
+
+  [[nodiscard]] Stats GetStats() const;
+  [[nodiscard]] std::size_t SlotCount() const { return slot_count_; }
+
+ private:
+  static constexpr int kKeyWords = 6;
+  static constexpr std::size_t kProbeLimit = 4;
+
+  // One cache line. version_ is 0 while empty, odd while being written.
+  struct alignas(64) Slot {
+    std::atomic<std::uint64_t> version_{0};
+    std::atomic<std::int64_t> key_[kKeyWords]{};
+    std::atomic<double> value_{0};
+  };
+
+  std::shared_ptr<const PriceEngine> inner_;
+  Options options_;
+  std::size_t slot_count_;
+  double inverse_tick_[5];  // spot, strike, time, rate, sigma
+  std::unique_ptr<Slot[]> slots_;
+
+  // Striped by thread so concurrent readers do not all bounce one line.
+  struct alignas(64) Counters {
+    std::atomic<std::uint64_t> hits_{0};
+    std::atomic<std::uint64_t> misses_{0};
+  };
+  static constexpr std::size_t kCounterStripes = 16;
+  [[nodiscard]] Counters& ThreadCounters() const;
+  std::unique_ptr<Counters[]> counters_;
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_CACHING_ENGINE_H
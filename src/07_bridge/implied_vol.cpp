@@ -0,0 +1,173 @@
+#include "implied_vol.h"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <span>
+
+#include "../helpers/SimdLanes.h"
+#include "black_scholes_kernel.h"
+
+namespace {
+
+template <class V>
+typename V::Reg SolveLanes(const typename V::Reg kSpot,
+                           const typename V::Reg kStrike,
+                           const typename V::Reg kTime,
+                           const typename V::Reg kRate,
+                           const typename V::Reg kPrice,
+                           const typename V::Mask kIsCall,
+                           const ImpliedVolSolver::Options& kOptions) {
+  using Reg = typename V::Reg;
+  const Reg kZero = V::Set1(0.0);
+  const Reg kOne = V::Set1(1.0);
+  const Reg kHalf = V::Set1(0.5);
+
+  // Everything but d1/d2 is fixed per quote, so hoist it out of the loop.
+  const Reg kSign = V::Select(kIsCall, kOne, V::Set1(-1.0));
+  const Reg kStrikeDisc = kStrike * Exp<V>(-kRate * kTime);
+  const auto kDegenerate = V::Or(
+      V::Le(kTime, kZero), V::Or(V::Le(kSpot, kZero), V::Le(kStrike, kZero)));
+  const Reg kT = V::Select(kDegenerate, kOne, kTime);
+  const Reg kSqrtT = V::Sqrt(kT);
+  const Reg kDrift =
+      Log<V>(V::Select(kDegenerate, kOne, kSpot / kStrike)) + kRate * kT;
+
+  const Reg kLower = V::Max(kZero, kSign * (kSpot - kStrikeDisc));
+  const Reg kUpper = V::Select(kIsCall, kSpot, kStrikeDisc);
+  const auto kSolvable = V::AndNot(
+      V::And(V::Gt(kPrice, kLower), V::Lt(kPrice, kUpper)), kDegenerate);
+  auto active = kSolvable;
+
+  // Corrado-Miller on the call-equivalent premium.
+  const Reg kForwardGap = kSpot - kStrikeDisc;
+  const Reg kCall = V::Select(kIsCall, kPrice, kPrice + kForwardGap);
+  const Reg kCentred = kCall - kHalf * kForwardGap;
+  const Reg kRoot = V::Sqrt(V::Max(
+      kZero, kCentred * kCentred -
+                 kForwardGap * kForwardGap * V::Set1(std::numbers::inv_pi)));
+  const Reg kGuess = V::Set1(std::sqrt(2 * std::numbers::pi)) *
+                     (kCentred + kRoot) / ((kSpot + kStrikeDisc) * kSqrtT);
+
+  const Reg kMaxVol = V::Set1(kOptions.max_vol_);
+  const Reg kPriceTolerance = V::Set1(kOptions.price_tolerance_) * kSpot;
+  const Reg kVolTolerance = V::Set1(kOptions.vol_tolerance_);
+  const auto kGuessUsable =
+      V::And(V::Gt(kGuess, kZero), V::Lt(kGuess, kMaxVol));
+  Reg sigma = V::Select(kGuessUsable, kGuess, V::Set1(0.5));
+  Reg lower = kZero;
+  Reg upper = kMaxVol;
+
+  for (int i = 0; i < kOptions.max_iterations_ && V::Any(active); ++i) {
+    const Reg kVolSqrtT = sigma * kSqrtT;
+    const Reg kD1 = kDrift / kVolSqrtT + kHalf * kVolSqrtT;
+    const Reg kD2 = kD1 - kVolSqrtT;
+    const Reg kGauss = Exp<V>(-kHalf * kD1 * kD1);
+    const Reg kModel =
+        kSign * (kSpot * NormalCdf<V>(kSign * kD1, kGauss) -
+                 kStrikeDisc *
+                     NormalCdf<V>(kSign * kD2, kGauss * kSpot / kStrikeDisc));
+    const Reg kVega = kSpot * kGauss *
+                      V::Set1(std::numbers::inv_sqrtpi / std::numbers::sqrt2) *
+                      kSqrtT;
+
+    const Reg kError = kModel - kPrice;
+    upper = V::Select(V::And(active, V::Gt(kError, kZero)), sigma, upper);
+    lower = V::Select(V::And(active, V::Lt(kError, kZero)), sigma, lower);
+
+    const Reg kNewton = kError / kVega;
+    const Reg kVolgaOverVega = kD1 * kD2 / sigma;
+    const Reg kHalley = kNewton / (kOne - kHalf * kNewton * kVolgaOverVega);
+    Reg next = sigma - kHalley;
+    next = V::Select(V::And(V::Gt(next, lower), V::Lt(next, upper)), next,
+                     kHalf * (lower + upper));
+
+    const auto kMoving =
+        V::And(active, V::Gt(V::Abs(kError), kPriceTolerance));
+    const Reg kStep = V::Abs(next - sigma);
+    sigma = V::Select(kMoving, next, sigma);
+    active = V::And(kMoving, V::Gt(kStep, kVolTolerance));
+  }
+
+  const Reg kNaN = V::Set1(std::numeric_limits<double>::quiet_NaN());
+  return V::Select(kSolvable, sigma, kNaN);
+}
+
+}  // namespace
+
+std::size_t QuoteBatch::Size() const { return spot_.size(); }
+
+absl::Status QuoteBatch::Validate(const std::size_t kOutSize) const {
+  const std::size_t kSize = Size();
+  if (strike_.size() != kSize || time_.size() != kSize ||
+      rate_.size() != kSize || price_.size() != kSize ||
+      right_.size() != kSize) {
+    return absl::InvalidArgumentError("quote batch spans differ in length");
+  }
+  if (kOutSize != kSize) {
+    return absl::InvalidArgumentError("output span does not match batch size");
+  }
+  return absl::OkStatus();
+}
+
+ImpliedVolSolver::ImpliedVolSolver(const Options options)
+    : options_(options) {}
+
+// NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+double ImpliedVolSolver::Solve(const double kSpot, const double kStrike,
+                               const double kTime, const double kRate,
+                               const double kPrice, const Right kRight) const {
+  return SolveLanes<ScalarLanes>(kSpot, kStrike, kTime, kRate, kPrice,
+                                 kRight == Right::kCall, options_);
+}
+
+absl::Status ImpliedVolSolver::SolveBatch(const QuoteBatch& kQuotes,
+                                          std::span<double> out) const {
+  if (auto status = kQuotes.Validate(out.size()); !status.ok()) return status;
+
+  using V = NativeLanes;
+  const std::size_t kSize = kQuotes.Size();
+  const std::size_t kVectorEnd = kSize - (kSize % V::kWidth);
+  for (std::size_t i = 0; i < kVectorEnd; i += V::kWidth) {
+    V::Store(out.data() + i,
+             SolveLanes<V>(V::Load(kQuotes.spot_.data() + i),
+                           V::Load(kQuotes.strike_.data() + i),
+                           V::Load(kQuotes.time_.data() + i),
+                           V::Load(kQuotes.rate_.data() + i),
+                           V::Load(kQuotes.price_.data() + i),
+                           V::LoadEq(kQuotes.right_.data() + i, Right::kCall),
+                           options_));
+  }
+  for (std::size_t i = kVectorEnd; i < kSize; ++i) {
+    out[i] = Solve(kQuotes.spot_[i], kQuotes.strike_[i], kQuotes.time_[i],
+                   kQuotes.rate_[i], kQuotes.price_[i], kQuotes.right_[i]);
+  }
+  return absl::OkStatus();
+}
+
+// NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+double ImpliedVolSolver::Bisect(const PriceEngine& kEngine, const double kSpot,
+                                const double kStrike, const double kTime,
+                                const double kRate, const double kPrice,
+                                const Right kRight) const {
+  // Price at sigma = 0 is the undiscounted payoff, so start just above it.
+  double lower = options_.vol_tolerance_;
+  double upper = options_.max_vol_;
+  const auto kError = [&](const double kSigma) {
+    return kEngine.Price(kSpot, kStrike, kTime, kRate, kSigma, kRight) -
+           kPrice;
+  };
+  if (!(kError(lower) < 0 && kError(upper) > 0)) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  while (upper - lower > options_.vol_tolerance_) {
+    const double kMid = 0.5 * (lower + upper);
+    if (kError(kMid) > 0) {
+      upper = kMid;
+    } else {
+      lower = kMid;
+    }
+  }
+  return 0.5 * (lower + upper);
+}
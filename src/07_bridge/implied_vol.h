@@ -0,0 +1,64 @@
+#ifndef GOF23_IMPLIED_VOL_H
+#define GOF23_IMPLIED_VOL_H
+
+#include <cstddef>
+#include <span>
+
+#include <absl/status/status.h>
+
+#include "bridge.h"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+// Structure-of-arrays view over market quotes to invert; element i of every
+// span describes the same option and price_ is its observed premium.
+struct QuoteBatch {
+  std::span<const double> spot_;
+  std::span<const double> strike_;
+  std::span<const double> time_;
+  std::span<const double> rate_;
+  std::span<const double> price_;
+  std::span<const Right> right_;
+
+  [[nodiscard]] std::size_t Size() const;
+  [[nodiscard]] absl::Status Validate(std::size_t kOutSize) const;
+};
+
+// Backs Black-Scholes volatilities out of option premiums. Quotes outside
+// the no-arbitrage band (intrinsic, spot or discounted strike), expired or
+// with a zero spot or strike have no implied vol and come back as NaN.
+class ImpliedVolSolver {
+ public:
+  struct Options {
+    double vol_tolerance_ = 1e-10;    // stop once a step moves vol less
+    double price_tolerance_ = 1e-13;  // or the repricing error per unit spot
+    double max_vol_ = 10.0;
+    int max_iterations_ = 32;
+  };
+
+  ImpliedVolSolver() = default;
+  explicit ImpliedVolSolver(Options options);
+
+  // Corrado-Miller initial guess refined by Halley steps on the analytic
+  // vega and volga, bracketed so a wild step falls back to bisection.
+  [[nodiscard]] double Solve(double kSpot, double kStrike, double kTime,
+                             double kRate, double kPrice, Right kRight) const;
+
+  // Solve over whole chains, one SIMD register of quotes at a time. Lanes
+  // freeze once converged and a register stops iterating when all have.
+  absl::Status SolveBatch(const QuoteBatch& kQuotes,
+                          std::span<double> out) const;
+
+  // Engine-agnostic bisection on Price up to max_vol_; slow, but works
+  // for engines without a closed-form vega.
+  [[nodiscard]] double Bisect(const PriceEngine& kEngine, double kSpot,
+                              double kStrike, double kTime, double kRate,
+                              double kPrice, Right kRight) const;
+
+ private:
+  Options options_;
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_IMPLIED_VOL_H
@@ -0,0 +1,219 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <absl/status/status.h>
+
+#include "bridge.h"
+
+namespace {
+
+// Options rolled together by PriceSweep: one cache line of doubles per node,
+// which the inner per-option loop fills with a single vector op or two.
+constexpr std::size_t kSweepWidth = 8;
+
+// Everything about the tree that does not depend on the strike.
+struct Lattice {
+  Lattice(const LatticeEngine& kEngine, const double kSpot, const double kTime,
+          const double kRate, const double kSigma)
+      : steps_(kEngine.steps_),
+        trinomial_(kEngine.tree_ == LatticeEngine::Tree::kTrinomial),
+        spot_(2 * static_cast<std::size_t>(steps_) + 1) {
+    const double kDt = kTime / steps_;
+    const double kDisc = std::exp(-kRate * kDt);
+    double log_step = 0;
+    if (trinomial_) {
+      const double kDrift = kRate - 0.5 * kSigma * kSigma;
+      const double kSkew = kDrift * std::sqrt(kDt / (12 * kSigma * kSigma));
+      log_step = kSigma * std::sqrt(3 * kDt);
+      up_ = kDisc * (1.0 / 6 + kSkew);
+      mid_ = kDisc * 2.0 / 3;
+      down_ = kDisc * (1.0 / 6 - kSkew);
+    } else {
+      log_step = kSigma * std::sqrt(kDt);
+      const double kUp = std::exp(log_step);
+      const double kProb = (std::exp(kRate * kDt) - 1 / kUp) / (kUp - 1 / kUp);
+      up_ = kDisc * kProb;
+      down_ = kDisc * (1 - kProb);
+    }
+    // One exp per level rather than a running product, so deep nodes carry
+    // no accumulated rounding.
+    for (int k = -steps_; k <= steps_; ++k) {
+      spot_[k + steps_] = kSpot * std::exp(k * log_step);
+    }
+  }
+
+  // Node j of level i sits (2j - i) binomial or (j - i) trinomial log steps
+  // from the root.
+  [[nodiscard]] double SpotAt(const int kLevel, const int kNode) const {
+    return spot_[(trinomial_ ? kNode : 2 * kNode) - kLevel + steps_];
+  }
+
+  [[nodiscard]] int Width(const int kLevel) const {
+    return (trinomial_ ? 2 * kLevel : kLevel) + 1;
+  }
+
+  int steps_;
+  bool trinomial_;
+  std::vector<double> spot_;  // kSpot * e^{k dx} for k in [-steps, steps]
+  double up_{};               // discounted branch probabilities
+  double mid_{};
+  double down_{};
+};
+
+// Backward induction for kWidth options at once. values holds node-major
+// rows of kWidth option values and is overwritten in place level by level:
+// node j of level i only reads nodes j..j+2 of level i + 1, which sit at or
+// after it in the buffer.
+template <std::size_t kWidth, bool kTrinomial, bool kAmerican>
+void Roll(const Lattice& kLattice, const double* strikes, const Right* rights,
+          double* out, std::vector<double>& values) {
+  double strike[kWidth];
+  double sign[kWidth];
+  for (std::size_t k = 0; k < kWidth; ++k) {
+    strike[k] = strikes[k];
+    sign[k] = rights[k] == Right::kCall ? 1.0 : -1.0;
+  }
+
+  const int kSteps = kLattice.steps_;
+  values.resize(static_cast<std::size_t>(kLattice.Width(kSteps)) * kWidth);
+  double* const kValues = values.data();
+
+  for (int j = 0; j < kLattice.Width(kSteps); ++j) {
+    const double kS = kLattice.SpotAt(kSteps, j);
+    double* node = kValues + (j * kWidth);
+    for (std::size_t k = 0; k < kWidth; ++k) {
+      node[k] = std::max(0.0, sign[k] * (kS - strike[k]));
+    }
+  }
+
+  const double kUp = kLattice.up_;
+  const double kMid = kLattice.mid_;
+  const double kDown = kLattice.down_;
+  for (int i = kSteps - 1; i >= 0; --i) {
+    for (int j = 0; j < kLattice.Width(i); ++j) {
+      double* node = kValues + (j * kWidth);
+      const double* next = node + kWidth;
+      [[maybe_unused]] const double kS = kLattice.SpotAt(i, j);
+      for (std::size_t k = 0; k < kWidth; ++k) {
+        double hold = 0;
+        if constexpr (kTrinomial) {
+          hold = (kDown * node[k]) + (kMid * next[k]) +
+                 (kUp * next[k + kWidth]);
+        } else {
+          hold = (kDown * node[k]) + (kUp * next[k]);
+        }
+        if constexpr (kAmerican) {
+          node[k] = std::max(hold, sign[k] * (kS - strike[k]));
+        } else {
+          node[k] = hold;
+        }
+      }
+    }
+  }
+
+  for (std::size_t k = 0; k < kWidth; ++k) out[k] = kValues[k];
+}
+
+template <std::size_t kWidth>
+void Roll(const Lattice& kLattice, const Exercise kExercise,
+          const double* strikes, const Right* rights, double* out,
+          std::vector<double>& values) {
+  const bool kAmerican = kExercise == Exercise::kAmerican;
+  if (kLattice.trinomial_ && kAmerican) {
+    Roll<kWidth, true, true>(kLattice, strikes, rights, out, values);
+  } else if (kLattice.trinomial_) {
+    Roll<kWidth, true, false>(kLattice, strikes, rights, out, values);
+  } else if (kAmerican) {
+    Roll<kWidth, false, true>(kLattice, strikes, rights, out, values);
+  } else {
+    Roll<kWidth, false, false>(kLattice, strikes, rights, out, values);
+  }
+}
+
+double Intrinsic(const double kSpot, const double kStrike, const Right kRight) {
+  return kRight == Right::kCall ? std::max(0.0, kSpot - kStrike)
+                                : std::max(0.0, kStrike - kSpot);
+}
+
+}  // namespace
+
+LatticeEngine::LatticeEngine(const int kSteps, const Tree kTree,
+                             const Exercise kExercise)
+    : steps_(std::max(1, kSteps)), tree_(kTree), exercise_(kExercise) {}
+
+// NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+double LatticeEngine::Price(const double kSpot, const double kStrike,
+                            const double kTime, const double kRate,
+                            const double kSigma, const Right kRight) const {
+  if (kTime <= 0 || kSigma <= 0) return Intrinsic(kSpot, kStrike, kRight);
+
+  const Lattice kLattice(*this, kSpot, kTime, kRate, kSigma);
+  std::vector<double> values;
+  double price = 0;
+  Roll<1>(kLattice, exercise_, &kStrike, &kRight, &price, values);
+  return price;
+}
+
+absl::Status LatticeEngine::PriceBatch(const OptionBatch& kBatch,
+                                       std::span<double> out) const {
+  if (auto status = kBatch.Validate(out.size()); !status.ok()) return status;
+
+  const std::size_t kSize = kBatch.Size();
+  for (std::size_t begin = 0, end = 0; begin < kSize; begin = end) {
+    const auto kSameUnderlying = [&](const std::size_t kIndex) {
+      return kBatch.spot_[kIndex] == kBatch.spot_[begin] &&
+             kBatch.time_[kIndex] == kBatch.time_[begin] &&
+             kBatch.rate_[kIndex] == kBatch.rate_[begin] &&
+             kBatch.sigma_[kIndex] == kBatch.sigma_[begin];
+    };
+    for (end = begin + 1; end < kSize && kSameUnderlying(end); ++end) {
+    }
+    const std::size_t kCount = end - begin;
+    if (auto status = PriceSweep(
+            kBatch.spot_[begin], kBatch.time_[begin], kBatch.rate_[begin],
+            kBatch.sigma_[begin], kBatch.strike_.subspan(begin, kCount),
+            kBatch.right_.subspan(begin, kCount), out.subspan(begin, kCount));
+        !status.ok()) {
+      return status;
+    }
+  }
+  return absl::OkStatus();
+}
+
+// NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+absl::Status LatticeEngine::PriceSweep(const double kSpot, const double kTime,
+                                       const double kRate, const double kSigma,
+                                       std::span<const double> strikes,
+                                       std::span<const Right> rights,
+                                       std::span<double> out) const {
+  const std::size_t kSize = strikes.size();
+  if (rights.size() != kSize) {
+    return absl::InvalidArgumentError("sweep spans differ in length");
+  }
+  if (out.size() != kSize) {
+    return absl::InvalidArgumentError("output span does not match sweep size");
+  }
+
+  if (kTime <= 0 || kSigma <= 0) {
+    for (std::size_t i = 0; i < kSize; ++i) {
+      out[i] = Intrinsic(kSpot, strikes[i], rights[i]);
+    }
+    return absl::OkStatus();
+  }
+
+  const Lattice kLattice(*this, kSpot, kTime, kRate, kSigma);
+  std::vector<double> values;
+  std::size_t i = 0;
+  for (; i + kSweepWidth <= kSize; i += kSweepWidth) {
+    Roll<kSweepWidth>(kLattice, exercise_, strikes.data() + i,
+                      rights.data() + i, out.data() + i, values);
+  }
+  for (; i < kSize; ++i) {
+    Roll<1>(kLattice, exercise_, strikes.data() + i, rights.data() + i,
+            out.data() + i, values);
+  }
+  return absl::OkStatus();
+}
@@ -0,0 +1,219 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "../helpers/Philox.h"
+#include "../helpers/WorkStealingPool.h"
+#include "bridge.h"
+
+namespace {
+
+// Samples per unit of work. Blocks are what threads claim and what gets
+// reduced in order, so the estimate depends on this but never on the
+// thread count.
+constexpr std::uint64_t kBlockSamples = 4096;
+
+// Running sums of one block of samples, each shifted by the control's exact
+// value so the variance sums do not cancel.
+struct Moments {
+  void Add(const double kY, const double kX) {
+    y_ += kY;
+    x_ += kX;
+    xx_ += kX * kX;
+    xy_ += kX * kY;
+    yy_ += kY * kY;
+  }
+
+  void Merge(const Moments& kOther) {
+    y_ += kOther.y_;
+    x_ += kOther.x_;
+    xx_ += kOther.xx_;
+    xy_ += kOther.xy_;
+    yy_ += kOther.yy_;
+  }
+
+  double y_{}, x_{}, xx_{}, xy_{}, yy_{};
+};
+
+struct PathModel {
+  double spot_;
+  double strike_;
+  double drift_;  // (r - sigma^2 / 2) dt
+  double vol_;    // sigma sqrt(dt)
+  double disc_;   // e^{-rT}
+  double shift_;  // the control's exact value
+  Right right_;
+  int steps_;
+  bool antithetic_;
+  const Payoff* payoff_;
+  Philox4x32 rng_;
+};
+
+// Fills path (and its antithetic mirror) for sample kSample. Normals 2c and
+// 2c + 1 of a sample come from Philox block (sample, c), so each path's
+// draws are fixed by its index alone.
+void DrawPaths(const PathModel& kModel, const std::uint64_t kSample,
+               std::span<double> path, std::span<double> mirror) {
+  double log_up = 0;
+  double log_down = 0;
+  for (int step = 0; step < kModel.steps_; step += 2) {
+    const auto [kFirst, kSecond] = Philox4x32::ToNormals(kModel.rng_(
+        {static_cast<std::uint32_t>(kSample),
+         static_cast<std::uint32_t>(kSample >> 32),
+         static_cast<std::uint32_t>(step / 2), 0}));
+    for (const auto& [kOffset, kNormal] : {std::pair{0, kFirst},
+                                           std::pair{1, kSecond}}) {
+      const int kStep = step + kOffset;
+      if (kStep == kModel.steps_) break;
+      log_up += kModel.drift_ + (kModel.vol_ * kNormal);
+      path[kStep] = kModel.spot_ * std::exp(log_up);
+      if (kModel.antithetic_) {
+        log_down += kModel.drift_ - (kModel.vol_ * kNormal);
+        mirror[kStep] = kModel.spot_ * std::exp(log_down);
+      }
+    }
+  }
+}
+
+Moments SimulateBlock(const PathModel& kModel, const std::uint64_t kBegin,
+                      const std::uint64_t kEnd, std::span<double> path,
+                      std::span<double> mirror) {
+  const VanillaPayoff kVanilla;
+  Moments moments;
+  for (std::uint64_t sample = kBegin; sample < kEnd; ++sample) {
+    DrawPaths(kModel, sample, path, mirror);
+    double payoff = kModel.payoff_->Value(path, kModel.strike_, kModel.right_);
+    double control = kVanilla.Value(path, kModel.strike_, kModel.right_);
+    if (kModel.antithetic_) {
+      payoff = 0.5 * (payoff + kModel.payoff_->Value(mirror, kModel.strike_,
+                                                     kModel.right_));
+      control = 0.5 * (control + kVanilla.Value(mirror, kModel.strike_,
+                                                kModel.right_));
+    }
+    moments.Add((kModel.disc_ * payoff) - kModel.shift_,
+                (kModel.disc_ * control) - kModel.shift_);
+  }
+  return moments;
+}
+
+double Intrinsic(const double kSpot, const double kStrike, const Right kRight) {
+  return kRight == Right::kCall ? std::max(0.0, kSpot - kStrike)
+                                : std::max(0.0, kStrike - kSpot);
+}
+
+}  // namespace
+
+// NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+double VanillaPayoff::Value(const std::span<const double> kPath,
+                            const double kStrike, const Right kRight) const {
+  return Intrinsic(kPath.back(), kStrike, kRight);
+}
+
+// NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+double AsianPayoff::Value(const std::span<const double> kPath,
+                          const double kStrike, const Right kRight) const {
+  const double kAverage = std::accumulate(kPath.begin(), kPath.end(), 0.0) /
+                          static_cast<double>(kPath.size());
+  return Intrinsic(kAverage, kStrike, kRight);
+}
+
+struct MonteCarloEngine::Workers {
+  explicit Workers(const unsigned kThreads) : pool_(kThreads) {}
+
+  std::mutex mutex_;  // held for the length of a ParallelFor
+  WorkStealingPool pool_;
+};
+
+MonteCarloEngine::MonteCarloEngine() : MonteCarloEngine(Options{}) {}
+
+MonteCarloEngine::MonteCarloEngine(Options options)
+    : options_(std::move(options)),
+      workers_(std::make_unique<Workers>(options_.threads_)) {}
+
+MonteCarloEngine::~MonteCarloEngine() = default;
+
+// NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+double MonteCarloEngine::Price(const double kSpot, const double kStrike,
+                               const double kTime, const double kRate,
+                               const double kSigma, const Right kRight) const {
+  return Simulate(kSpot, kStrike, kTime, kRate, kSigma, kRight).price_;
+}
+
+// NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+MonteCarloEngine::Estimate MonteCarloEngine::Simulate(
+    const double kSpot, const double kStrike, const double kTime,
+    const double kRate, const double kSigma, const Right kRight) const {
+  if (kTime <= 0 || kSigma <= 0) return {Intrinsic(kSpot, kStrike, kRight)};
+
+  const VanillaPayoff kVanilla;
+  const int kSteps = std::max(1, options_.steps_);
+  const double kDt = kTime / kSteps;
+  const double kControl =
+      BlackScholesEngine{}.Price(kSpot, kStrike, kTime, kRate, kSigma, kRight);
+  const PathModel kModel{
+      .spot_ = kSpot,
+      .strike_ = kStrike,
+      .drift_ = (kRate - (0.5 * kSigma * kSigma)) * kDt,
+      .vol_ = kSigma * std::sqrt(kDt),
+      .disc_ = std::exp(-kRate * kTime),
+      .shift_ = kControl,
+      .right_ = kRight,
+      .steps_ = kSteps,
+      .antithetic_ = options_.antithetic_,
+      .payoff_ = options_.payoff_ ? options_.payoff_.get() : &kVanilla,
+      .rng_ = Philox4x32(options_.seed_)};
+
+  const std::uint64_t kSamples = std::max<std::uint64_t>(
+      2, options_.antithetic_ ? options_.paths_ / 2 : options_.paths_);
+  const std::size_t kBlocks = (kSamples + kBlockSamples - 1) / kBlockSamples;
+  std::vector<Moments> blocks(kBlocks);
+  // A path and a mirror row per pool participant.
+  const auto kRow = static_cast<std::size_t>(kSteps);
+  std::vector<double> scratch(2 * kRow * workers_->pool_.Size());
+  const auto kWork = [&](const unsigned kParticipant, const std::size_t kFirst,
+                         const std::size_t kEnd) {
+    const std::span<double> kRows =
+        std::span(scratch).subspan(2 * kRow * kParticipant, 2 * kRow);
+    for (std::size_t block = kFirst; block < kEnd; ++block) {
+      const std::uint64_t kBegin = block * kBlockSamples;
+      blocks[block] = SimulateBlock(
+          kModel, kBegin, std::min(kSamples, kBegin + kBlockSamples),
+          kRows.first(kRow), kRows.last(kRow));
+    }
+  };
+
+  // The pool runs one job at a time. A Simulate that finds it busy runs on
+  // its own thread instead, which changes nothing but the speed.
+  if (std::unique_lock lock(workers_->mutex_, std::try_to_lock);
+      lock.owns_lock()) {
+    workers_->pool_.ParallelFor(kBlocks, 1, kWork);
+  } else {
+    kWork(0, 0, kBlocks);
+  }
+
+  Moments total;
+  for (const Moments& kBlock : blocks) total.Merge(kBlock);
+
+  const auto kN = static_cast<double>(kSamples);
+  const double kMeanY = total.y_ / kN;
+  const double kMeanX = total.x_ / kN;
+  const double kVarX = (total.xx_ / kN) - (kMeanX * kMeanX);
+  const double kVarY = (total.yy_ / kN) - (kMeanY * kMeanY);
+  const double kCov = (total.xy_ / kN) - (kMeanX * kMeanY);
+  const double kBeta =
+      options_.control_variate_ && kVarX > 0 ? kCov / kVarX : 0.0;
+
+  // Undo the shift: mean(Y) - beta (mean(X) - kControl) with both means
+  // taken over the shifted samples.
+  const double kVariance =
+      kVarY - (2 * kBeta * kCov) + (kBeta * kBeta * kVarX);
+  return {.price_ = kControl + kMeanY - (kBeta * kMeanX),
+          .std_error_ = std::sqrt(std::max(0.0, kVariance) / (kN - 1))};
+}
@@ -0,0 +1,137 @@
+#include "option_book.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <absl/status/status.h>
+#include <absl/status/statusor.h>
+#include <absl/strings/str_format.h>
+#include <absl/strings/string_view.h>
+
+OptionBatch OptionBook::Group::Batch() const {
+  return {spot_, strike_, time_, rate_, sigma_, right_};
+}
+
+OptionBook::OptionBook(std::shared_ptr<const PriceEngine> engine)
+    : engine_(std::move(engine)) {}
+
+absl::StatusOr<OptionHandle> OptionBook::Add(
+    const absl::string_view kUnderlying, const EuropeanOption& kOption) {
+  if (kUnderlying.empty()) {
+    return absl::InvalidArgumentError("underlying must not be empty");
+  }
+  if (!std::isfinite(kOption.spot_)) {
+    return absl::InvalidArgumentError("spot must be finite");
+  }
+
+  const auto kExisting = group_by_underlying_.find(kUnderlying);
+  if (kExisting != group_by_underlying_.end() &&
+      kOption.spot_ != groups_[kExisting->second].spot_.front()) {
+    return absl::InvalidArgumentError(
+        absl::StrFormat("%s is at %g, not %g", kUnderlying,
+                        groups_[kExisting->second].spot_.front(),
+                        kOption.spot_));
+  }
+
+  // Priced through the same batch kernel as UpdateSpot, so an update that
+  // changes nothing leaves the value's bits alone too.
+  double value = 0;
+  const OptionBatch kOne{std::span(&kOption.spot_, 1),
+                         std::span(&kOption.strike_, 1),
+                         std::span(&kOption.time_, 1),
+                         std::span(&kOption.rate_, 1),
+                         std::span(&kOption.sigma_, 1),
+                         std::span(&kOption.right_, 1)};
+  if (auto status = engine_->PriceBatch(kOne, std::span(&value, 1));
+      !status.ok()) {
+    return status;
+  }
+
+  const auto [kIt, kInserted] = group_by_underlying_.try_emplace(
+      kUnderlying, static_cast<std::uint32_t>(groups_.size()));
+  if (kInserted) groups_.emplace_back();
+  Group& group = groups_[kIt->second];
+
+  group.spot_.push_back(kOption.spot_);
+  group.strike_.push_back(kOption.strike_);
+  group.time_.push_back(kOption.time_);
+  group.rate_.push_back(kOption.rate_);
+  group.sigma_.push_back(kOption.sigma_);
+  group.right_.push_back(kOption.right_);
+  group.value_.push_back(value);
+  group.dirty_.push_back(0);
+
+  const OptionHandle kHandle{
+      .group_ = kIt->second,
+      .index_ = static_cast<std::uint32_t>(group.value_.size() - 1)};
+  MarkDirty(kHandle.group_, kHandle.index_);
+  return kHandle;
+}
+
+absl::Status OptionBook::UpdateSpot(const absl::string_view kUnderlying,
+                                    const double kSpot) {
+  if (!std::isfinite(kSpot)) {
+    return absl::InvalidArgumentError("spot must be finite");
+  }
+  const auto kIt = group_by_underlying_.find(kUnderlying);
+  if (kIt == group_by_underlying_.end()) {
+    return absl::NotFoundError(
+        absl::StrFormat("no options on %s", kUnderlying));
+  }
+  const std::uint32_t kGroupIndex = kIt->second;
+  Group& group = groups_[kGroupIndex];
+  if (group.spot_.front() == kSpot) return absl::OkStatus();
+
+  // The group keeps its old spot until the new one has priced, so a failed
+  // update can be retried.
+  next_spot_.assign(group.spot_.size(), kSpot);
+  repriced_.resize(group.value_.size());
+  OptionBatch batch = group.Batch();
+  batch.spot_ = next_spot_;
+  if (auto status = engine_->PriceBatch(batch, repriced_); !status.ok()) {
+    return status;
+  }
+  std::swap(group.spot_, next_spot_);
+  for (std::size_t i = 0; i < repriced_.size(); ++i) {
+    if (repriced_[i] == group.value_[i]) continue;
+    group.value_[i] = repriced_[i];
+    MarkDirty(kGroupIndex, static_cast<std::uint32_t>(i));
+  }
+  return absl::OkStatus();
+}
+
+absl::StatusOr<double> OptionBook::Value(const OptionHandle kHandle) const {
+  if (kHandle.group_ >= groups_.size() ||
+      kHandle.index_ >= groups_[kHandle.group_].value_.size()) {
+    return absl::OutOfRangeError("no such option in the book");
+  }
+  return groups_[kHandle.group_].value_[kHandle.index_];
+}
+
+std::vector<OptionHandle> OptionBook::TakeDirty() {
+  std::vector<OptionHandle> dirty = std::exchange(dirty_, {});
+  for (const OptionHandle kHandle : dirty) {
+    groups_[kHandle.group_].dirty_[kHandle.index_] = 0;
+  }
+  return dirty;
+}
+
+std::size_t OptionBook::Size() const {
+  std::size_t size = 0;
+  for (const Group& kGroup : groups_) size += kGroup.value_.size();
+  return size;
+}
+
+void OptionBook::MarkDirty(const std::uint32_t kGroup,
+                           const std::uint32_t kIndex) {
+  std::uint8_t& flag = groups_[kGroup].dirty_[kIndex];
+  if (flag != 0) return;
+  flag = 1;
+  dirty_.push_back({.group_ = kGroup, .index_ = kIndex});
+}
@@ -0,0 +1,78 @@
+#ifndef GOF23_OPTION_BOOK_H
+#define GOF23_OPTION_BOOK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/status/status.h>
+#include <absl/status/statusor.h>
+#include <absl/strings/string_view.h>
+
+#include "bridge.h"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+// Where an option lives in an OptionBook; stable for the book's lifetime.
+struct OptionHandle {
+  std::uint32_t group_{};
+  std::uint32_t index_{};
+
+  bool operator==(const OptionHandle&) const = default;
+};
+
+// Options grouped by underlying into contiguous structure-of-arrays groups.
+// A spot update reprices only that underlying's group, in one PriceBatch
+// call, and records which options changed value in a dirty list that
+// consumers drain, so a tick costs work proportional to the options it
+// actually moves. Not thread safe: one writer, or external locking.
+class OptionBook {
+ public:
+  explicit OptionBook(std::shared_ptr<const PriceEngine> engine);
+
+  // Books kOption under kUnderlying and prices it. The first option on an
+  // underlying sets its spot, which must be finite; later ones must agree
+  // with it.
+  absl::StatusOr<OptionHandle> Add(absl::string_view kUnderlying,
+                                   const EuropeanOption& kOption);
+
+  // Moves kUnderlying to kSpot and reprices its group. A non-finite kSpot
+  // is rejected; on any error the group keeps its old spot and values.
+  absl::Status UpdateSpot(absl::string_view kUnderlying, double kSpot);
+
+  [[nodiscard]] absl::StatusOr<double> Value(OptionHandle kHandle) const;
+
+  // Every option whose value changed since the last call, once each, in the
+  // order they first changed.
+  std::vector<OptionHandle> TakeDirty();
+
+  [[nodiscard]] std::size_t Size() const;
+
+ private:
+  // One underlying. OptionBatch wants a spot per option, so the group's
+  // spot is repeated down spot_.
+  struct Group {
+    [[nodiscard]] OptionBatch Batch() const;
+
+    std::vector<double> spot_, strike_, time_, rate_, sigma_;
+    std::vector<Right> right_;
+    std::vector<double> value_;
+    std::vector<std::uint8_t> dirty_;
+  };
+
+  void MarkDirty(std::uint32_t kGroup, std::uint32_t kIndex);
+
+  std::shared_ptr<const PriceEngine> engine_;
+  absl::flat_hash_map<std::string, std::uint32_t> group_by_underlying_;
+  std::vector<Group> groups_;
+  std::vector<OptionHandle> dirty_;
+  std::vector<double> next_spot_;  // the spot being priced, reused
+  std::vector<double> repriced_;   // PriceBatch output, reused across ticks
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_OPTION_BOOK_H
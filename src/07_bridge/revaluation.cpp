@@ -0,0 +1,96 @@
+#include "revaluation.h"
+
+#include <cstddef>
+#include <mutex>
+#include <span>
+#include <utility>
+
+#include <absl/status/status.h>
+
+namespace {
+
+// The first failure any chunk reports; later ones are dropped.
+class FirstError {
+ public:
+  void Record(absl::Status status) {
+    if (status.ok()) return;
+    const std::lock_guard kLock(mutex_);
+    if (status_.ok()) status_ = std::move(status);
+  }
+
+  absl::Status Take() { return std::move(status_); }
+
+ private:
+  std::mutex mutex_;
+  absl::Status status_;
+};
+
+}  // namespace
+
+void PortfolioRevaluer::Scratch::Resize(const std::size_t kSize) {
+  spot_.resize(kSize);
+  strike_.resize(kSize);
+  time_.resize(kSize);
+  rate_.resize(kSize);
+  sigma_.resize(kSize);
+  right_.resize(kSize);
+}
+
+PortfolioRevaluer::PortfolioRevaluer() : PortfolioRevaluer(Options{}) {}
+
+PortfolioRevaluer::PortfolioRevaluer(const Options options)
+    : options_(options), pool_(options.threads_), scratch_(pool_.Size()) {}
+
+absl::Status PortfolioRevaluer::Revalue(const PriceEngine& kEngine,
+                                        const OptionBatch& kBatch,
+                                        const std::span<double> out) {
+  if (auto status = kBatch.Validate(out.size()); !status.ok()) return status;
+
+  FirstError error;
+  pool_.ParallelFor(
+      kBatch.Size(), options_.chunk_,
+      [&](unsigned /*participant*/, const std::size_t kBegin,
+          const std::size_t kEnd) {
+        const std::size_t kCount = kEnd - kBegin;
+        const OptionBatch kChunk{kBatch.spot_.subspan(kBegin, kCount),
+                                 kBatch.strike_.subspan(kBegin, kCount),
+                                 kBatch.time_.subspan(kBegin, kCount),
+                                 kBatch.rate_.subspan(kBegin, kCount),
+                                 kBatch.sigma_.subspan(kBegin, kCount),
+                                 kBatch.right_.subspan(kBegin, kCount)};
+        error.Record(kEngine.PriceBatch(kChunk, out.subspan(kBegin, kCount)));
+      });
+  return error.Take();
+}
+
+absl::Status PortfolioRevaluer::Revalue(
+    const PriceEngine& kEngine, const std::span<const EuropeanOption> kOptions,
+    const std::span<double> out) {
+  if (out.size() != kOptions.size()) {
+    return absl::InvalidArgumentError("output span does not match book size");
+  }
+
+  FirstError error;
+  pool_.ParallelFor(
+      kOptions.size(), options_.chunk_,
+      [&](const unsigned kParticipant, const std::size_t kBegin,
+          const std::size_t kEnd) {
+        const std::size_t kCount = kEnd - kBegin;
+        Scratch& scratch = scratch_[kParticipant];
+        scratch.Resize(kCount);
+        for (std::size_t i = 0; i < kCount; ++i) {
+          const EuropeanOption& kOption = kOptions[kBegin + i];
+          scratch.spot_[i] = kOption.spot_;
+          scratch.strike_[i] = kOption.strike_;
+          scratch.time_[i] = kOption.time_;
+          scratch.rate_[i] = kOption.rate_;
+          scratch.sigma_[i] = kOption.sigma_;
+          scratch.right_[i] = kOption.right_;
+        }
+        error.Record(kEngine.PriceBatch(
+            {scratch.spot_, scratch.strike_, scratch.time_, scratch.rate_,
+             scratch.sigma_, scratch.right_},
+            out.subspan(kBegin, kCount)));
+      });
+  return error.Take();
+}
@@ -0,0 +1,61 @@
+#ifndef GOF23_REVALUATION_H
+#define GOF23_REVALUATION_H
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <absl/status/status.h>
+
+#include "../helpers/WorkStealingPool.h"
+#include "bridge.h"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+// Prices whole books across every core. Options are cut into fixed chunks
+// that a WorkStealingPool spreads over its threads, and each chunk goes
+// through the engine's PriceBatch, so a SIMD engine stays vectorized inside
+// every thread. out[i] is always option i's price, and since chunk
+// boundaries never depend on the thread count, neither do the results.
+//
+// One Revalue at a time per revaluer; the engine must allow concurrent
+// PriceBatch calls, as every engine in this module does.
+class PortfolioRevaluer {
+ public:
+  struct Options {
+    std::size_t chunk_ = 1024;  // options per task
+    unsigned threads_ = 0;      // 0: one per hardware thread
+  };
+
+  PortfolioRevaluer();
+  explicit PortfolioRevaluer(Options options);
+
+  absl::Status Revalue(const PriceEngine& kEngine, const OptionBatch& kBatch,
+                       std::span<double> out);
+
+  // Prices each option under kEngine, not the engine set on the option.
+  // Every chunk is gathered into per-thread structure-of-arrays scratch
+  // before pricing.
+  absl::Status Revalue(const PriceEngine& kEngine,
+                       std::span<const EuropeanOption> kOptions,
+                       std::span<double> out);
+
+  [[nodiscard]] unsigned ThreadCount() const { return pool_.Size(); }
+
+ private:
+  // Own cache lines: neighbours grow their vectors concurrently.
+  struct alignas(64) Scratch {
+    void Resize(std::size_t kSize);
+
+    std::vector<double> spot_, strike_, time_, rate_, sigma_;
+    std::vector<Right> right_;
+  };
+
+  Options options_;
+  WorkStealingPool pool_;
+  std::vector<Scratch> scratch_;  // one per pool participant
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_REVALUATION_H
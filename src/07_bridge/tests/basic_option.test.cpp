@@ -0,0 +1,64 @@
+#include "basic_option.h"
+
+#include <cmath>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "bridge.h"
+
+namespace {
+
+// An engine outside the PriceEngine hierarchy.
+struct ForwardEngine {
+  [[nodiscard]] static double Price(const double kSpot, const double kStrike,
+                                    const double kTime, const double kRate,
+                                    [[maybe_unused]] const double kSigma,
+                                    const Right kRight) {
+    const double kForward = kSpot - (kStrike * std::exp(-kRate * kTime));
+    return kRight == Right::kCall ? kForward : -kForward;
+  }
+};
+
+static_assert(StaticPriceEngine<BlackScholesEngine>);
+static_assert(StaticPriceEngine<ForwardEngine>);
+static_assert(!StaticPriceEngine<int>);
+
+}  // namespace
+
+class BasicOptionSuite : public ::testing::Test {
+ protected:
+  static constexpr double kSpot = 120;
+  static constexpr double kStrike = 100;
+  static constexpr double kTime = 1;
+  static constexpr double kRate = 0.01;
+  static constexpr double kSigma = 0.25;
+
+  template <class Engine>
+  static void ExpectSameAsTheRuntimeOption(Engine engine) {
+    for (const Right kRight : {Right::kCall, Right::kPut}) {
+      EuropeanOption runtime{kSpot, kStrike, kTime, kRate, kSigma, kRight};
+      runtime.SetEngine(std::make_shared<Engine>(engine));
+      const BasicEuropeanOption<Engine> kBound{
+          kSpot, kStrike, kTime, kRate, kSigma, kRight, engine};
+      EXPECT_EQ(kBound.Value(), runtime.Value());
+      EXPECT_EQ(kBound.Risk().delta_, runtime.Risk().delta_);
+    }
+  }
+};
+
+TEST_F(BasicOptionSuite, ShouldPriceLikeTheRuntimeOption) {
+  ExpectSameAsTheRuntimeOption(BlackScholesEngine{});
+  ExpectSameAsTheRuntimeOption(DummyEngine{});
+  ExpectSameAsTheRuntimeOption(LatticeEngine{200});
+}
+
+TEST_F(BasicOptionSuite, ShouldAcceptEnginesOutsideTheHierarchy) {
+  const BasicEuropeanOption<ForwardEngine> kForward{
+      kSpot, kStrike, kTime, kRate, kSigma, Right::kCall};
+  const BlackScholesOption kCall{kSpot, kStrike, kTime,
+                                 kRate, kSigma, Right::kCall};
+  const BlackScholesOption kPut{kSpot, kStrike, kTime,
+                                kRate, kSigma, Right::kPut};
+  EXPECT_NEAR(kCall.Value() - kPut.Value(), kForward.Value(), 1e-12);
+}
@@ -0,0 +1,123 @@
+#include "black_scholes_kernel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <vector>
+
+#include <absl/status/status.h>
+#include <gtest/gtest.h>
+
+#include "bridge.h"
+
+class BatchSuite : public ::testing::Test {
+ protected:
+  // Every combination of the grids below bar spot == strike == 0, which the
+  // scalar engine prices as 0/0. The odd length (11*4*3*4*2 + 1 = 1057) leaves
+  // a partial last block for every lane width.
+  void SetUp() override {
+    for (const double kSpot : {0.0, 80.0, 120.0}) {
+      for (const double kStrike : {0.0, 50.0, 100.0, 400.0}) {
+        if (kSpot == 0 && kStrike == 0) continue;
+        for (const double kTime : {0.0, 0.01, 1.0, 30.0}) {
+          for (const double kRate : {-0.01, 0.0, 0.05}) {
+            for (const double kSigma : {0.0, 0.05, 0.25, 2.0}) {
+              for (const Right kRight : {Right::kCall, Right::kPut}) {
+                Push(kSpot, kStrike, kTime, kRate, kSigma, kRight);
+              }
+            }
+          }
+        }
+      }
+    }
+    Push(120, 100, 1, 0.01, 0.25, Right::kPut);
+  }
+
+  void Push(const double kSpot, const double kStrike, const double kTime,
+            const double kRate, const double kSigma, const Right kRight) {
+    spot_.push_back(kSpot);
+    strike_.push_back(kStrike);
+    time_.push_back(kTime);
+    rate_.push_back(kRate);
+    sigma_.push_back(kSigma);
+    right_.push_back(kRight);
+  }
+
+  [[nodiscard]] OptionBatch Batch() const {
+    return {spot_, strike_, time_, rate_, sigma_, right_};
+  }
+
+  std::vector<double> spot_, strike_, time_, rate_, sigma_;
+  std::vector<Right> right_;
+};
+
+TEST_F(BatchSuite, ShouldMatchTheScalarEngineWithinTolerance) {
+  const BlackScholesEngine kEngine;
+  std::vector<double> out(spot_.size());
+  ASSERT_TRUE(kEngine.PriceBatch(Batch(), out).ok());
+
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    const double kExpected = kEngine.Price(spot_[i], strike_[i], time_[i],
+                                           rate_[i], sigma_[i], right_[i]);
+    const double kScale = std::max({1.0, spot_[i], strike_[i]});
+    EXPECT_NEAR(out[i], kExpected, kBatchPriceTolerance * kScale)
+        << "option " << i << " on " << BatchKernelIsa();
+  }
+}
+
+TEST_F(BatchSuite, ShouldPriceAnOptionAloneAsInABatch) {
+  const BlackScholesEngine kEngine;
+  std::vector<double> out(spot_.size());
+  ASSERT_TRUE(kEngine.PriceBatch(Batch(), out).ok());
+
+  for (std::size_t i = 0; i < out.size(); i += 7) {
+    const OptionBatch kOne = {std::span(spot_).subspan(i, 1),
+                              std::span(strike_).subspan(i, 1),
+                              std::span(time_).subspan(i, 1),
+                              std::span(rate_).subspan(i, 1),
+                              std::span(sigma_).subspan(i, 1),
+                              std::span(right_).subspan(i, 1)};
+    double alone = 0;
+    ASSERT_TRUE(kEngine.PriceBatch(kOne, std::span(&alone, 1)).ok());
+    EXPECT_EQ(alone, out[i]) << "option " << i << " on " << BatchKernelIsa();
+  }
+}
+
+TEST_F(BatchSuite, ShouldFallBackToPriceForEnginesWithoutAKernel) {
+  const DummyEngine kEngine;
+  std::vector<double> out(spot_.size());
+  ASSERT_TRUE(kEngine.PriceBatch(Batch(), out).ok());
+
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    EXPECT_EQ(out[i], kEngine.Price(spot_[i], strike_[i], time_[i], rate_[i],
+                                    sigma_[i], right_[i]));
+  }
+}
+
+TEST_F(BatchSuite, ShouldRejectMismatchedSpans) {
+  const BlackScholesEngine kEngine;
+  std::vector<double> out(spot_.size());
+
+  OptionBatch batch = Batch();
+  batch.sigma_ = batch.sigma_.first(1);
+  EXPECT_EQ(kEngine.PriceBatch(batch, out).code(),
+            absl::StatusCode::kInvalidArgument);
+
+  out.pop_back();
+  EXPECT_EQ(kEngine.PriceBatch(Batch(), out).code(),
+            absl::StatusCode::kInvalidArgument);
+}
+
+TEST(SimdMathSuite, ShouldMatchTheLibmWithinAFewUlp) {
+  for (double x = -700; x < 700; x += 0.37) {
+    EXPECT_NEAR(Exp<ScalarLanes>(x), std::exp(x), 4e-16 * std::exp(x));
+  }
+  for (double x = 1e-300; x < 1e300; x *= 7.3) {
+    EXPECT_NEAR(Log<ScalarLanes>(x), std::log(x),
+                4e-16 * std::max(1.0, std::fabs(std::log(x))));
+  }
+  for (double x = -40; x < 40; x += 0.01) {
+    EXPECT_NEAR(NormalCdf<ScalarLanes>(x), BlackScholesEngine::NormalCDF(x),
+                1e-14);
+  }
+}
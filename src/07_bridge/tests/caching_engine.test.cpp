@@ -0,0 +1,115 @@
+#include "caching_engine.h"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "bridge.h"
+
+class CachingEngineSuite : public ::testing::Test {
+ protected:
+  static constexpr double kSpot = 120;
+  static constexpr double kStrike = 100;
+  static constexpr double kTime = 1;
+  static constexpr double kRate = 0.01;
+  static constexpr double kSigma = 0.25;
+
+  static CachingEngine::Options Small() {
+    CachingEngine::Options options;
+    options.capacity_ = 16;
+    options.spot_tick_ = 0.01;
+    return options;
+  }
+
+  const std::shared_ptr<const BlackScholesEngine> inner_ =
+      std::make_shared<BlackScholesEngine>();
+};
+
+TEST_F(CachingEngineSuite, ShouldHitOnRepeatedInputs) {
+  const CachingEngine kEngine(inner_);
+  const double kFirst =
+      kEngine.Price(kSpot, kStrike, kTime, kRate, kSigma, Right::kCall);
+  const double kSecond =
+      kEngine.Price(kSpot, kStrike, kTime, kRate, kSigma, Right::kCall);
+  EXPECT_EQ(kFirst, kSecond);
+  // The inner engine may round differently at another call site.
+  EXPECT_DOUBLE_EQ(
+      kFirst,
+      inner_->Price(kSpot, kStrike, kTime, kRate, kSigma, Right::kCall));
+  EXPECT_EQ(kEngine.GetStats().hits_, 1);
+  EXPECT_EQ(kEngine.GetStats().misses_, 1);
+
+  (void)kEngine.Price(kSpot, kStrike, kTime, kRate, kSigma, Right::kPut);
+  EXPECT_EQ(kEngine.GetStats().misses_, 2);
+}
+
+TEST_F(CachingEngineSuite, ShouldPriceTheSnappedPointForNearbyInputs) {
+  const CachingEngine kEngine(inner_, Small());
+  const double kSnapped =
+      inner_->Price(120.01, kStrike, kTime, kRate, kSigma, Right::kCall);
+  EXPECT_DOUBLE_EQ(kEngine.Price(120.0149, kStrike, kTime, kRate, kSigma,
+                                 Right::kCall),
+                   kSnapped);
+  EXPECT_DOUBLE_EQ(kEngine.Price(120.0051, kStrike, kTime, kRate, kSigma,
+                                 Right::kCall),
+                   kSnapped);
+  EXPECT_EQ(kEngine.GetStats().hits_, 1);
+}
+
+TEST_F(CachingEngineSuite, ShouldStayWithinItsSlotsAndStayCorrect) {
+  const CachingEngine kEngine(inner_, Small());
+  EXPECT_EQ(kEngine.SlotCount(), 16);
+  for (int round = 0; round < 2; ++round) {
+    for (int i = 0; i < 200; ++i) {
+      const double kS = 80 + (0.25 * i);
+      EXPECT_DOUBLE_EQ(
+          kEngine.Price(kS, kStrike, kTime, kRate, kSigma, Right::kPut),
+          inner_->Price(kS, kStrike, kTime, kRate, kSigma, Right::kPut));
+    }
+  }
+  const CachingEngine::Stats kStats = kEngine.GetStats();
+  EXPECT_EQ(kStats.hits_ + kStats.misses_, 400);
+  EXPECT_GT(kStats.misses_, 200);
+}
+
+TEST_F(CachingEngineSuite, ShouldBypassInputsThatCannotBeSnapped) {
+  const CachingEngine kEngine(inner_);
+  const double kNaN = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_TRUE(std::isnan(
+      kEngine.Price(kSpot, kStrike, kTime, kRate, kNaN, Right::kCall)));
+  EXPECT_EQ(kEngine.GetStats().misses_, 1);
+}
+
+TEST_F(CachingEngineSuite, ShouldServeConcurrentCallers) {
+  const CachingEngine kEngine(inner_, Small());
+  constexpr int kThreads = 4;
+  constexpr int kCalls = 20'000;
+  std::vector<int> wrong(kThreads);
+  {
+    std::vector<std::jthread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+      threads.emplace_back([&, t] {
+        for (int i = 0; i < kCalls; ++i) {
+          // 32 keys over 16 slots: plenty of evictions and racing writes.
+          const double kS = 100 + ((i * 7 + t) % 32);
+          const double kCached =
+              kEngine.Price(kS, kStrike, kTime, kRate, kSigma, Right::kCall);
+          const double kDirect =
+              inner_->Price(kS, kStrike, kTime, kRate, kSigma, Right::kCall);
+          if (!(std::abs(kCached - kDirect) <= 1e-12)) {
+            ++wrong[t];
+          }
+        }
+      });
+    }
+  }
+  for (const int kWrong : wrong) EXPECT_EQ(kWrong, 0);
+  const CachingEngine::Stats kStats = kEngine.GetStats();
+  EXPECT_EQ(kStats.hits_ + kStats.misses_,
+            static_cast<std::uint64_t>(kThreads) * kCalls);
+}
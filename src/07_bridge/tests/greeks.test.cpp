@@ -0,0 +1,140 @@
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <absl/status/status.h>
+#include <gtest/gtest.h>
+
+#include "black_scholes_kernel.h"
+#include "bridge.h"
+
+class GreeksSuite : public ::testing::Test {
+ protected:
+  static constexpr double kSpot = 120;
+  static constexpr double kStrike = 100;
+  static constexpr double kTime = 1;
+  static constexpr double kRate = 0.01;
+  static constexpr double kSigma = 0.25;
+
+  static void ExpectNearRelative(const double kActual, const double kExpected,
+                                 const double kTolerance) {
+    EXPECT_NEAR(kActual, kExpected,
+                kTolerance * std::max(1.0, std::fabs(kExpected)));
+  }
+
+  const BlackScholesEngine engine_;
+};
+
+TEST_F(GreeksSuite, ShouldPriceExactlyLikePrice) {
+  for (const Right kRight : {Right::kCall, Right::kPut}) {
+    const Greeks kGreeks =
+        engine_.Risk(kSpot, kStrike, kTime, kRate, kSigma, kRight);
+    EXPECT_DOUBLE_EQ(kGreeks.price_,
+                     engine_.Price(kSpot, kStrike, kTime, kRate, kSigma,
+                                   kRight));
+  }
+}
+
+TEST_F(GreeksSuite, ShouldAgreeWithBumpAndReprice) {
+  for (const Right kRight : {Right::kCall, Right::kPut}) {
+    const Greeks kAnalytic =
+        engine_.Risk(kSpot, kStrike, kTime, kRate, kSigma, kRight);
+    const Greeks kBumped = engine_.PriceEngine::Risk(kSpot, kStrike, kTime,
+                                                     kRate, kSigma, kRight);
+    ExpectNearRelative(kAnalytic.delta_, kBumped.delta_, 1e-6);
+    ExpectNearRelative(kAnalytic.gamma_, kBumped.gamma_, 1e-5);
+    ExpectNearRelative(kAnalytic.vega_, kBumped.vega_, 1e-5);
+    ExpectNearRelative(kAnalytic.theta_, kBumped.theta_, 1e-5);
+    ExpectNearRelative(kAnalytic.rho_, kBumped.rho_, 1e-5);
+    ExpectNearRelative(kAnalytic.vanna_, kBumped.vanna_, 1e-4);
+    ExpectNearRelative(kAnalytic.volga_, kBumped.volga_, 1e-4);
+  }
+}
+
+TEST_F(GreeksSuite, ShouldSatisfyPutCallParity) {
+  const Greeks kCall =
+      engine_.Risk(kSpot, kStrike, kTime, kRate, kSigma, Right::kCall);
+  const Greeks kPut =
+      engine_.Risk(kSpot, kStrike, kTime, kRate, kSigma, Right::kPut);
+  const double kStrikeDisc = kStrike * std::exp(-kRate * kTime);
+
+  EXPECT_NEAR(kCall.price_ - kPut.price_, kSpot - kStrikeDisc, 1e-12);
+  EXPECT_NEAR(kCall.delta_ - kPut.delta_, 1.0, 1e-15);
+  EXPECT_DOUBLE_EQ(kCall.gamma_, kPut.gamma_);
+  EXPECT_DOUBLE_EQ(kCall.vega_, kPut.vega_);
+  EXPECT_NEAR(kCall.theta_ - kPut.theta_, -kRate * kStrikeDisc, 1e-12);
+  EXPECT_NEAR(kCall.rho_ - kPut.rho_, kTime * kStrikeDisc, 1e-12);
+}
+
+TEST_F(GreeksSuite, ShouldCollapseToThePayoffWhenExpired) {
+  const Greeks kGreeks =
+      engine_.Risk(kSpot, kStrike, 0, kRate, kSigma, Right::kCall);
+  EXPECT_EQ(kGreeks.price_, kSpot - kStrike);
+  EXPECT_EQ(kGreeks.delta_, 1.0);
+  EXPECT_EQ(kGreeks.gamma_, 0.0);
+  EXPECT_EQ(kGreeks.vega_, 0.0);
+}
+
+TEST_F(GreeksSuite, ShouldBumpThroughPriceForEnginesWithoutAClosedForm) {
+  const DummyEngine kDummy;
+  const Greeks kGreeks =
+      kDummy.Risk(kSpot, kStrike, kTime, kRate, kSigma, Right::kPut);
+  EXPECT_EQ(kGreeks.price_, 0.0);
+  EXPECT_EQ(kGreeks.delta_, 0.0);
+  EXPECT_EQ(kGreeks.vega_, 0.0);
+}
+
+TEST_F(GreeksSuite, ShouldExposeRiskThroughTheOption) {
+  EuropeanOption option(kSpot, kStrike, kTime, kRate, kSigma, Right::kCall);
+  option.SetEngine(std::make_shared<BlackScholesEngine>());
+  EXPECT_EQ(option.Risk().price_, option.Value());
+  EXPECT_GT(option.Risk().delta_, 0.5);
+}
+
+TEST_F(GreeksSuite, ShouldMatchScalarRiskWhenBatched) {
+  std::vector<double> spot, strike, time, rate, sigma;
+  std::vector<Right> right;
+  for (const double kS : {0.0, 60.0, 100.0, 180.0}) {
+    for (const double kK : {0.0, 100.0}) {
+      if (kS == 0 && kK == 0) continue;
+      for (const double kT : {0.0, 0.05, 1.0, 10.0}) {
+        for (const double kV : {0.0, 0.1, 0.8}) {
+          for (const Right kR : {Right::kCall, Right::kPut}) {
+            spot.push_back(kS);
+            strike.push_back(kK);
+            time.push_back(kT);
+            rate.push_back(0.03);
+            sigma.push_back(kV);
+            right.push_back(kR);
+          }
+        }
+      }
+    }
+  }
+  const std::size_t kSize = spot.size();
+  std::vector<std::vector<double>> columns(8, std::vector<double>(kSize));
+  const GreeksBatch kOut{columns[0], columns[1], columns[2], columns[3],
+                         columns[4], columns[5], columns[6], columns[7]};
+  const OptionBatch kBatch{spot, strike, time, rate, sigma, right};
+  ASSERT_TRUE(engine_.RiskBatch(kBatch, kOut).ok());
+
+  for (std::size_t i = 0; i < kSize; ++i) {
+    const Greeks kExpected =
+        engine_.Risk(spot[i], strike[i], time[i], rate[i], sigma[i], right[i]);
+    SCOPED_TRACE(testing::Message() << "option " << i);
+    ExpectNearRelative(kOut.price_[i], kExpected.price_, kBatchGreeksTolerance);
+    ExpectNearRelative(kOut.delta_[i], kExpected.delta_, kBatchGreeksTolerance);
+    ExpectNearRelative(kOut.gamma_[i], kExpected.gamma_, kBatchGreeksTolerance);
+    ExpectNearRelative(kOut.vega_[i], kExpected.vega_, kBatchGreeksTolerance);
+    ExpectNearRelative(kOut.theta_[i], kExpected.theta_, kBatchGreeksTolerance);
+    ExpectNearRelative(kOut.rho_[i], kExpected.rho_, kBatchGreeksTolerance);
+    ExpectNearRelative(kOut.vanna_[i], kExpected.vanna_, kBatchGreeksTolerance);
+    ExpectNearRelative(kOut.volga_[i], kExpected.volga_, kBatchGreeksTolerance);
+  }
+
+  columns[3].pop_back();
+  const GreeksBatch kShort{columns[0], columns[1], columns[2], columns[3],
+                           columns[4], columns[5], columns[6], columns[7]};
+  EXPECT_EQ(engine_.RiskBatch(kBatch, kShort).code(),
+            absl::StatusCode::kInvalidArgument);
+}
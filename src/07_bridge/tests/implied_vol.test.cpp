@@ -0,0 +1,104 @@
+#include "implied_vol.h"
+
+#include <cmath>
+#include <vector>
+
+#include <absl/status/status.h>
+#include <gtest/gtest.h>
+
+#include "bridge.h"
+
+class ImpliedVolSuite : public ::testing::Test {
+ protected:
+  static constexpr double kSpot = 100;
+  static constexpr double kRate = 0.02;
+
+  // A chain filtered to quotes with enough vega to pin vol down to 1e-8;
+  // deep in-the-money low-vol premiums are their forward to machine
+  // precision and say nothing about vol. The odd length leaves a scalar tail.
+  void SetUp() override {
+    for (const double kStrike : {70.0, 90.0, 100.0, 110.0, 140.0}) {
+      for (const double kTime : {0.1, 0.5, 2.0}) {
+        for (const double kSigma : {0.08, 0.2, 0.45, 1.5}) {
+          for (const Right kRight : {Right::kCall, Right::kPut}) {
+            const Greeks kGreeks =
+                engine_.Risk(kSpot, kStrike, kTime, kRate, kSigma, kRight);
+            if (kGreeks.vega_ < 1e-1) continue;
+            spot_.push_back(kSpot);
+            strike_.push_back(kStrike);
+            time_.push_back(kTime);
+            rate_.push_back(kRate);
+            price_.push_back(kGreeks.price_);
+            right_.push_back(kRight);
+            sigma_.push_back(kSigma);
+          }
+        }
+      }
+    }
+    if (spot_.size() % 2 == 0) {
+      spot_.pop_back();
+      strike_.pop_back();
+      time_.pop_back();
+      rate_.pop_back();
+      price_.pop_back();
+      right_.pop_back();
+      sigma_.pop_back();
+    }
+  }
+
+  [[nodiscard]] QuoteBatch Quotes() const {
+    return {spot_, strike_, time_, rate_, price_, right_};
+  }
+
+  const BlackScholesEngine engine_;
+  const ImpliedVolSolver solver_;
+  std::vector<double> spot_, strike_, time_, rate_, price_, sigma_;
+  std::vector<Right> right_;
+};
+
+TEST_F(ImpliedVolSuite, ShouldRecoverTheVolatilityThatPricedTheQuote) {
+  for (std::size_t i = 0; i < price_.size(); ++i) {
+    EXPECT_NEAR(solver_.Solve(spot_[i], strike_[i], time_[i], rate_[i],
+                              price_[i], right_[i]),
+                sigma_[i], 1e-8)
+        << "quote " << i;
+  }
+}
+
+TEST_F(ImpliedVolSuite, ShouldMatchScalarSolvesWhenBatched) {
+  std::vector<double> out(price_.size());
+  ASSERT_TRUE(solver_.SolveBatch(Quotes(), out).ok());
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    EXPECT_NEAR(out[i],
+                solver_.Solve(spot_[i], strike_[i], time_[i], rate_[i],
+                              price_[i], right_[i]),
+                1e-12)
+        << "quote " << i;
+  }
+}
+
+TEST_F(ImpliedVolSuite, ShouldAgreeWithBisection) {
+  for (std::size_t i = 0; i < price_.size(); ++i) {
+    const double kNewton = solver_.Solve(spot_[i], strike_[i], time_[i],
+                                         rate_[i], price_[i], right_[i]);
+    const double kBisect = solver_.Bisect(engine_, spot_[i], strike_[i],
+                                          time_[i], rate_[i], price_[i],
+                                          right_[i]);
+    EXPECT_NEAR(kNewton, kBisect, 1e-8) << "quote " << i;
+  }
+}
+
+TEST_F(ImpliedVolSuite, ShouldReturnNaNOutsideTheArbitrageBounds) {
+  // Below intrinsic, above spot, expired and a zero strike.
+  EXPECT_TRUE(std::isnan(solver_.Solve(kSpot, 80, 1, kRate, 1, Right::kCall)));
+  EXPECT_TRUE(
+      std::isnan(solver_.Solve(kSpot, 80, 1, kRate, 101, Right::kCall)));
+  EXPECT_TRUE(std::isnan(solver_.Solve(kSpot, 80, 0, kRate, 21, Right::kCall)));
+  EXPECT_TRUE(std::isnan(solver_.Solve(kSpot, 0, 1, kRate, 50, Right::kPut)));
+}
+
+TEST_F(ImpliedVolSuite, ShouldRejectMismatchedSpans) {
+  std::vector<double> out(price_.size() + 1);
+  EXPECT_EQ(solver_.SolveBatch(Quotes(), out).code(),
+            absl::StatusCode::kInvalidArgument);
+}
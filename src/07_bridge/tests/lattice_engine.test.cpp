@@ -0,0 +1,117 @@
+#include <algorithm>
+#include <vector>
+
+#include <absl/status/status.h>
+#include <gtest/gtest.h>
+
+#include "bridge.h"
+
+class LatticeSuite : public ::testing::Test {
+ protected:
+  static constexpr double kSpot = 120;
+  static constexpr double kStrike = 100;
+  static constexpr double kTime = 1;
+  static constexpr double kRate = 0.01;
+  static constexpr double kSigma = 0.25;
+
+  const BlackScholesEngine black_scholes_;
+};
+
+TEST_F(LatticeSuite, ShouldConvergeToBlackScholesForEuropeanExercise) {
+  using Tree = LatticeEngine::Tree;
+  for (const Tree kTree : {Tree::kBinomial, Tree::kTrinomial}) {
+    const LatticeEngine kEngine(2000, kTree, Exercise::kEuropean);
+    for (const Right kRight : {Right::kCall, Right::kPut}) {
+      EXPECT_NEAR(
+          kEngine.Price(kSpot, kStrike, kTime, kRate, kSigma, kRight),
+          black_scholes_.Price(kSpot, kStrike, kTime, kRate, kSigma, kRight),
+          5e-3);
+    }
+  }
+}
+
+TEST_F(LatticeSuite, ShouldNeverExerciseACallEarlyWithoutDividends) {
+  const LatticeEngine kAmerican(500);
+  const LatticeEngine kEuropean(500, LatticeEngine::Tree::kBinomial,
+                                Exercise::kEuropean);
+  EXPECT_EQ(
+      kAmerican.Price(kSpot, kStrike, kTime, kRate, kSigma, Right::kCall),
+      kEuropean.Price(kSpot, kStrike, kTime, kRate, kSigma, Right::kCall));
+}
+
+TEST_F(LatticeSuite, ShouldPriceTheAmericanPutEarlyExercisePremium) {
+  // Longstaff & Schwartz (2001), table 1: S = 36, K = 40, r = 6%, sigma =
+  // 20%, T = 1. The accurate American value is 4.4867 (their least-squares
+  // Monte Carlo gets 4.472) against a European 3.844.
+  using Tree = LatticeEngine::Tree;
+  for (const Tree kTree : {Tree::kBinomial, Tree::kTrinomial}) {
+    const LatticeEngine kEngine(2000, kTree);
+    EXPECT_NEAR(kEngine.Price(36, 40, 1, 0.06, 0.2, Right::kPut), 4.4867,
+                5e-4);
+  }
+
+  // Deep in the money the put is worth exercising straight away.
+  const LatticeEngine kEngine(500);
+  EXPECT_DOUBLE_EQ(kEngine.Price(20, 100, 1, 0.05, 0.2, Right::kPut), 80);
+}
+
+TEST_F(LatticeSuite, ShouldReturnThePayoffWhenExpired) {
+  const LatticeEngine kEngine;
+  EXPECT_EQ(kEngine.Price(kSpot, kStrike, 0, kRate, kSigma, Right::kCall), 20);
+  EXPECT_EQ(kEngine.Price(kSpot, kStrike, kTime, kRate, 0, Right::kPut), 0);
+}
+
+TEST_F(LatticeSuite, ShouldSweepAChainLikePricingEachOption) {
+  // 19 options leave a remainder after the 8-wide sweeps.
+  std::vector<double> strikes;
+  std::vector<Right> rights;
+  for (double strike = 60; strike <= 150; strike += 5) {
+    strikes.push_back(strike);
+    rights.push_back(strikes.size() % 3 == 0 ? Right::kCall : Right::kPut);
+  }
+
+  using Tree = LatticeEngine::Tree;
+  for (const Tree kTree : {Tree::kBinomial, Tree::kTrinomial}) {
+    const LatticeEngine kEngine(300, kTree);
+    std::vector<double> out(strikes.size());
+    ASSERT_TRUE(kEngine
+                    .PriceSweep(kSpot, kTime, kRate, kSigma, strikes, rights,
+                                out)
+                    .ok());
+    for (std::size_t i = 0; i < strikes.size(); ++i) {
+      EXPECT_EQ(out[i], kEngine.Price(kSpot, strikes[i], kTime, kRate, kSigma,
+                                      rights[i]));
+    }
+  }
+}
+
+TEST_F(LatticeSuite, ShouldGroupABatchIntoSweepsByUnderlying) {
+  const std::vector<double> kSpots = {100, 100, 100, 90, 90, 100, 100};
+  const std::vector<double> kStrikes = {90, 100, 110, 90, 100, 90, 100};
+  const std::vector<double> kTimes = {1, 1, 1, 1, 1, 0.5, 0.5};
+  const std::vector<double> kRates(kSpots.size(), 0.03);
+  const std::vector<double> kSigmas(kSpots.size(), 0.3);
+  const std::vector<Right> kRights = {Right::kPut, Right::kCall, Right::kPut,
+                                      Right::kPut, Right::kPut,  Right::kCall,
+                                      Right::kPut};
+  const OptionBatch kBatch{kSpots, kStrikes, kTimes, kRates, kSigmas, kRights};
+
+  const LatticeEngine kEngine(200);
+  std::vector<double> out(kSpots.size());
+  ASSERT_TRUE(kEngine.PriceBatch(kBatch, out).ok());
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    EXPECT_EQ(out[i], kEngine.Price(kSpots[i], kStrikes[i], kTimes[i],
+                                    kRates[i], kSigmas[i], kRights[i]));
+  }
+}
+
+TEST_F(LatticeSuite, ShouldRejectMismatchedSweepSpans) {
+  const LatticeEngine kEngine;
+  const std::vector<double> kStrikes = {90, 100};
+  const std::vector<Right> kRights = {Right::kPut};
+  std::vector<double> out(2);
+  EXPECT_EQ(kEngine.PriceSweep(kSpot, kTime, kRate, kSigma, kStrikes, kRights,
+                               out)
+                .code(),
+            absl::StatusCode::kInvalidArgument);
+}
@@ -0,0 +1,152 @@
+#include <array>
+#include <cmath>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../helpers/Philox.h"
+#include "bridge.h"
+
+class MonteCarloSuite : public ::testing::Test {
+ protected:
+  static constexpr double kSpot = 120;
+  static constexpr double kStrike = 100;
+  static constexpr double kTime = 1;
+  static constexpr double kRate = 0.01;
+  static constexpr double kSigma = 0.25;
+
+  static MonteCarloEngine::Estimate Simulate(
+      const MonteCarloEngine::Options& kOptions, const Right kRight) {
+    return MonteCarloEngine(kOptions).Simulate(kSpot, kStrike, kTime, kRate,
+                                               kSigma, kRight);
+  }
+
+  static MonteCarloEngine::Options Plain() {
+    MonteCarloEngine::Options options;
+    options.paths_ = 1 << 16;
+    options.antithetic_ = false;
+    options.control_variate_ = false;
+    return options;
+  }
+
+  const BlackScholesEngine black_scholes_;
+};
+
+TEST(PhiloxSuite, ShouldMatchTheRandom123KnownAnswers) {
+  using Counter = Philox4x32::Counter;
+  EXPECT_EQ(Philox4x32(Philox4x32::Key{0, 0})(Counter{0, 0, 0, 0}),
+            (Counter{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+  EXPECT_EQ(Philox4x32(Philox4x32::Key{~0U, ~0U})(
+                Counter{~0U, ~0U, ~0U, ~0U}),
+            (Counter{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+  EXPECT_EQ(Philox4x32(Philox4x32::Key{0xa4093822, 0x299f31d0})(
+                Counter{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}),
+            (Counter{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+TEST_F(MonteCarloSuite, ShouldAgreeWithBlackScholesWithinFourStdErrors) {
+  for (const Right kRight : {Right::kCall, Right::kPut}) {
+    const MonteCarloEngine::Estimate kEstimate = Simulate(Plain(), kRight);
+    EXPECT_GT(kEstimate.std_error_, 0);
+    EXPECT_NEAR(
+        kEstimate.price_,
+        black_scholes_.Price(kSpot, kStrike, kTime, kRate, kSigma, kRight),
+        4 * kEstimate.std_error_);
+  }
+}
+
+TEST_F(MonteCarloSuite, ShouldBeBitIdenticalWhateverTheThreadCount) {
+  MonteCarloEngine::Options options;
+  options.paths_ = 100'000;  // not a whole number of blocks
+  options.steps_ = 3;
+  options.payoff_ = std::make_shared<AsianPayoff>();
+  options.threads_ = 1;
+  const MonteCarloEngine::Estimate kSerial = Simulate(options, Right::kPut);
+  for (const unsigned kThreads : {2U, 3U, 8U}) {
+    options.threads_ = kThreads;
+    const MonteCarloEngine::Estimate kParallel =
+        Simulate(options, Right::kPut);
+    EXPECT_EQ(kParallel.price_, kSerial.price_);
+    EXPECT_EQ(kParallel.std_error_, kSerial.std_error_);
+  }
+
+  options.seed_ = 1;
+  EXPECT_NE(Simulate(options, Right::kPut).price_, kSerial.price_);
+}
+
+TEST_F(MonteCarloSuite, ShouldShrinkTheErrorWithVarianceReduction) {
+  MonteCarloEngine::Options options = Plain();
+  options.steps_ = 12;
+  options.payoff_ = std::make_shared<AsianPayoff>();
+  const double kPlain = Simulate(options, Right::kCall).std_error_;
+
+  options.antithetic_ = true;
+  const double kAntithetic = Simulate(options, Right::kCall).std_error_;
+  EXPECT_LT(kAntithetic, 0.5 * kPlain);
+
+  options.control_variate_ = true;
+  const MonteCarloEngine::Estimate kControlled =
+      Simulate(options, Right::kCall);
+  EXPECT_LT(kControlled.std_error_, 0.75 * kAntithetic);
+
+  // Averaging damps the spot, so the Asian call is worth less than the
+  // vanilla one.
+  EXPECT_LT(kControlled.price_, black_scholes_.Price(kSpot, kStrike, kTime,
+                                                     kRate, kSigma,
+                                                     Right::kCall));
+}
+
+TEST_F(MonteCarloSuite, ShouldGiveConcurrentCallersTheSameEstimate) {
+  MonteCarloEngine::Options options = Plain();
+  options.threads_ = 3;
+  const MonteCarloEngine kEngine(options);
+  const double kExpected =
+      kEngine.Simulate(kSpot, kStrike, kTime, kRate, kSigma, Right::kPut)
+          .price_;
+
+  // Callers that find the pool busy run on their own thread instead.
+  std::array<double, 4> prices{};
+  {
+    std::vector<std::jthread> callers;
+    for (double& price : prices) {
+      callers.emplace_back([&] {
+        for (int i = 0; i < 8; ++i) {
+          price = kEngine.Price(kSpot, kStrike, kTime, kRate, kSigma,
+                                Right::kPut);
+        }
+      });
+    }
+  }
+  for (const double kPrice : prices) EXPECT_EQ(kPrice, kExpected);
+}
+
+TEST_F(MonteCarloSuite, ShouldRecoverBlackScholesWithItselfAsTheControl) {
+  // A vanilla payoff is its own control: beta fits to 1 and the noise
+  // cancels.
+  const MonteCarloEngine::Estimate kEstimate =
+      Simulate(MonteCarloEngine::Options{}, Right::kCall);
+  EXPECT_NEAR(kEstimate.price_,
+              black_scholes_.Price(kSpot, kStrike, kTime, kRate, kSigma,
+                                   Right::kCall),
+              1e-9);
+  EXPECT_LT(kEstimate.std_error_, 1e-9);
+}
+
+TEST_F(MonteCarloSuite, ShouldReturnThePayoffWhenExpired) {
+  const MonteCarloEngine kEngine;
+  const MonteCarloEngine::Estimate kEstimate =
+      kEngine.Simulate(kSpot, kStrike, 0, kRate, kSigma, Right::kCall);
+  EXPECT_EQ(kEstimate.price_, 20);
+  EXPECT_EQ(kEstimate.std_error_, 0);
+}
+
+TEST_F(MonteCarloSuite, ShouldPlugIntoAnOption) {
+  EuropeanOption call{kSpot, kStrike, kTime, kRate, kSigma, Right::kCall};
+  call.SetEngine(std::make_shared<MonteCarloEngine>(Plain()));
+  EXPECT_NEAR(call.Value(),
+              black_scholes_.Price(kSpot, kStrike, kTime, kRate, kSigma,
+                                   Right::kCall),
+              0.5);
+}
@@ -0,0 +1,137 @@
+#include "option_book.h"
+
+#include <limits>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <absl/status/status.h>
+#include <gtest/gtest.h>
+
+#include "bridge.h"
+
+namespace {
+
+// Black-Scholes whose batches fail while fail_ is set.
+struct FlakyEngine final : PriceEngine {
+  [[nodiscard]] double Price(const double kSpot, const double kStrike,
+                             const double kTime, const double kRate,
+                             const double kSigma,
+                             const Right kRight) const override {
+    return inner_.Price(kSpot, kStrike, kTime, kRate, kSigma, kRight);
+  }
+  absl::Status PriceBatch(const OptionBatch& kBatch,
+                          std::span<double> out) const override {
+    if (fail_) return absl::UnavailableError("engine down");
+    return inner_.PriceBatch(kBatch, out);
+  }
+
+  BlackScholesEngine inner_;
+  bool fail_ = false;
+};
+
+}  // namespace
+
+class OptionBookSuite : public ::testing::Test {
+ protected:
+  static EuropeanOption Make(const double kSpot, const double kStrike,
+                             const Right kRight = Right::kCall) {
+    return EuropeanOption(kSpot, kStrike, 1, 0.01, 0.25, kRight);
+  }
+
+  std::shared_ptr<const BlackScholesEngine> engine_ =
+      std::make_shared<BlackScholesEngine>();
+  OptionBook book_{engine_};
+};
+
+TEST_F(OptionBookSuite, ShouldPriceOptionsAsTheyAreAdded) {
+  const auto kHandle = book_.Add("ACME", Make(100, 95));
+  ASSERT_TRUE(kHandle.ok());
+  EXPECT_NEAR(*book_.Value(*kHandle),
+              engine_->Price(100, 95, 1, 0.01, 0.25, Right::kCall), 1e-10);
+  EXPECT_EQ(book_.Size(), 1);
+  EXPECT_EQ(book_.TakeDirty(), std::vector{*kHandle});
+  EXPECT_TRUE(book_.TakeDirty().empty());
+}
+
+TEST_F(OptionBookSuite, ShouldRepriceOnlyTheUpdatedUnderlying) {
+  const auto kAcme = book_.Add("ACME", Make(100, 95));
+  const auto kAcmePut = book_.Add("ACME", Make(100, 105, Right::kPut));
+  const auto kInitech = book_.Add("INITECH", Make(50, 50));
+  ASSERT_TRUE(kAcme.ok() && kAcmePut.ok() && kInitech.ok());
+  const double kInitechValue = *book_.Value(*kInitech);
+  (void)book_.TakeDirty();
+
+  // Repricing goes through the batch kernel, which agrees with the scalar
+  // price to rounding.
+  ASSERT_TRUE(book_.UpdateSpot("ACME", 110).ok());
+  EXPECT_NEAR(*book_.Value(*kAcme),
+              engine_->Price(110, 95, 1, 0.01, 0.25, Right::kCall), 1e-10);
+  EXPECT_NEAR(*book_.Value(*kAcmePut),
+              engine_->Price(110, 105, 1, 0.01, 0.25, Right::kPut), 1e-10);
+  EXPECT_EQ(*book_.Value(*kInitech), kInitechValue);
+  EXPECT_EQ(book_.TakeDirty(), (std::vector{*kAcme, *kAcmePut}));
+}
+
+TEST_F(OptionBookSuite, ShouldReportEachDirtyOptionOnce) {
+  const auto kHandle = book_.Add("ACME", Make(100, 95));
+  ASSERT_TRUE(kHandle.ok());
+  ASSERT_TRUE(book_.UpdateSpot("ACME", 101).ok());
+  ASSERT_TRUE(book_.UpdateSpot("ACME", 102).ok());
+  EXPECT_EQ(book_.TakeDirty(), std::vector{*kHandle});
+
+  // Same spot again: nothing moved, nothing to report.
+  ASSERT_TRUE(book_.UpdateSpot("ACME", 102).ok());
+  EXPECT_TRUE(book_.TakeDirty().empty());
+}
+
+TEST_F(OptionBookSuite, ShouldLeaveValuesAloneWhenTheSpotDoesNotMove) {
+  const auto kHandle = book_.Add("ACME", Make(100, 95));
+  ASSERT_TRUE(kHandle.ok());
+  const double kAdded = *book_.Value(*kHandle);
+  (void)book_.TakeDirty();
+
+  // A round trip reprices through the same kernel Add used.
+  ASSERT_TRUE(book_.UpdateSpot("ACME", 101).ok());
+  ASSERT_TRUE(book_.UpdateSpot("ACME", 100).ok());
+  EXPECT_EQ(*book_.Value(*kHandle), kAdded);
+}
+
+TEST_F(OptionBookSuite, ShouldKeepTheOldSpotWhenRepricingFails) {
+  const auto kEngine = std::make_shared<FlakyEngine>();
+  OptionBook book(kEngine);
+  const auto kHandle = book.Add("ACME", Make(100, 95));
+  ASSERT_TRUE(kHandle.ok());
+  const double kBefore = *book.Value(*kHandle);
+  (void)book.TakeDirty();
+
+  kEngine->fail_ = true;
+  EXPECT_EQ(book.UpdateSpot("ACME", 110).code(),
+            absl::StatusCode::kUnavailable);
+  EXPECT_EQ(*book.Value(*kHandle), kBefore);
+  EXPECT_TRUE(book.TakeDirty().empty());
+
+  // The retry is not mistaken for a no-op.
+  kEngine->fail_ = false;
+  ASSERT_TRUE(book.UpdateSpot("ACME", 110).ok());
+  EXPECT_NE(*book.Value(*kHandle), kBefore);
+  EXPECT_EQ(book.TakeDirty(), std::vector{*kHandle});
+}
+
+TEST_F(OptionBookSuite, ShouldRejectBadInput) {
+  EXPECT_EQ(book_.Add("", Make(100, 95)).status().code(),
+            absl::StatusCode::kInvalidArgument);
+  ASSERT_TRUE(book_.Add("ACME", Make(100, 95)).ok());
+  EXPECT_EQ(book_.Add("ACME", Make(101, 95)).status().code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(book_.UpdateSpot("INITECH", 50).code(),
+            absl::StatusCode::kNotFound);
+  const double kNaN = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_EQ(book_.UpdateSpot("ACME", kNaN).code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(book_.Add("INITECH", Make(kNaN, 95)).status().code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(book_.Value({.group_ = 0, .index_ = 1}).status().code(),
+            absl::StatusCode::kOutOfRange);
+  EXPECT_EQ(book_.Size(), 1);
+}
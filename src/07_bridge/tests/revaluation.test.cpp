@@ -0,0 +1,101 @@
+#include "revaluation.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <absl/status/status.h>
+#include <gtest/gtest.h>
+
+#include "../helpers/WorkStealingPool.h"
+#include "bridge.h"
+
+TEST(WorkStealingPoolSuite, ShouldRunEveryItemOnceAcrossRepeatedLoops) {
+  WorkStealingPool pool(4);
+  EXPECT_EQ(pool.Size(), 4);
+  constexpr std::size_t kCount = 10'007;
+  for (int round = 0; round < 20; ++round) {
+    std::vector<std::atomic<int>> hits(kCount);
+    std::atomic<bool> bad_participant{false};
+    pool.ParallelFor(kCount, 7,
+                     [&](const unsigned kParticipant, const std::size_t kBegin,
+                         const std::size_t kEnd) {
+                       if (kParticipant >= pool.Size()) bad_participant = true;
+                       // Skewed work so the back of the range gets stolen.
+                       double work = 0;
+                       for (std::size_t i = 0; i < kBegin / 8; ++i) {
+                         work += std::sqrt(static_cast<double>(i));
+                       }
+                       if (work < 0) bad_participant = true;
+                       for (std::size_t i = kBegin; i < kEnd; ++i) ++hits[i];
+                     });
+    EXPECT_FALSE(bad_participant);
+    for (std::size_t i = 0; i < kCount; ++i) ASSERT_EQ(hits[i], 1) << i;
+  }
+}
+
+class PortfolioRevaluerSuite : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    for (int i = 0; i < 5'003; ++i) {
+      options_.emplace_back(80 + (i % 41), 100, 0.1 + (0.001 * (i % 997)),
+                            0.02, 0.15 + (0.0001 * i),
+                            i % 3 == 0 ? Right::kPut : Right::kCall);
+      spot_.push_back(options_.back().spot_);
+      strike_.push_back(options_.back().strike_);
+      time_.push_back(options_.back().time_);
+      rate_.push_back(options_.back().rate_);
+      sigma_.push_back(options_.back().sigma_);
+      right_.push_back(options_.back().right_);
+    }
+  }
+
+  [[nodiscard]] OptionBatch Batch() const {
+    return {spot_, strike_, time_, rate_, sigma_, right_};
+  }
+
+  const BlackScholesEngine engine_;
+  std::vector<EuropeanOption> options_;
+  std::vector<double> spot_, strike_, time_, rate_, sigma_;
+  std::vector<Right> right_;
+};
+
+TEST_F(PortfolioRevaluerSuite, ShouldMatchOneThreadForAnyThreadCount) {
+  PortfolioRevaluer::Options options;
+  options.chunk_ = 64;
+  options.threads_ = 1;
+  PortfolioRevaluer serial(options);
+  std::vector<double> expected(options_.size());
+  ASSERT_TRUE(serial.Revalue(engine_, Batch(), expected).ok());
+  for (std::size_t i = 0; i < options_.size(); i += 101) {
+    EXPECT_NEAR(expected[i],
+                engine_.Price(spot_[i], strike_[i], time_[i], rate_[i],
+                              sigma_[i], right_[i]),
+                1e-10);
+  }
+
+  for (const unsigned kThreads : {2U, 3U, 8U}) {
+    options.threads_ = kThreads;
+    PortfolioRevaluer revaluer(options);
+    std::vector<double> soa(options_.size());
+    std::vector<double> aos(options_.size());
+    ASSERT_TRUE(revaluer.Revalue(engine_, Batch(), soa).ok());
+    ASSERT_TRUE(revaluer.Revalue(engine_, options_, aos).ok());
+    EXPECT_EQ(soa, expected) << kThreads;
+    EXPECT_EQ(aos, expected) << kThreads;
+  }
+}
+
+TEST_F(PortfolioRevaluerSuite, ShouldRejectMismatchedOutput) {
+  PortfolioRevaluer revaluer;
+  std::vector<double> out(options_.size() - 1);
+  EXPECT_EQ(revaluer.Revalue(engine_, Batch(), out).code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(revaluer.Revalue(engine_, options_, out).code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_TRUE(revaluer.Revalue(engine_, std::span<const EuropeanOption>{},
+                               std::span<double>{})
+                  .ok());
+}
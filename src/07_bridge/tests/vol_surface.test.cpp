@@ -0,0 +1,118 @@
+#include "vol_surface.h"
+
+#include <memory>
+#include <vector>
+
+#include <absl/status/status.h>
+#include <gtest/gtest.h>
+
+#include "bridge.h"
+
+class VolSurfaceSuite : public ::testing::Test {
+ protected:
+  // A smile over three strikes, steepening towards the front expiry.
+  static std::unique_ptr<VolSurface> Smile(
+      const VolSurface::Interpolation kInterpolation =
+          VolSurface::Interpolation::kBilinear) {
+    return *VolSurface::Create({80, 100, 120}, {0.5, 1.0},
+                               std::vector<double>{0.30, 0.20, 0.26,  //
+                                                   0.26, 0.20, 0.23},
+                               kInterpolation);
+  }
+};
+
+TEST_F(VolSurfaceSuite, ShouldInterpolateBilinearly) {
+  const auto kSurface = Smile();
+  EXPECT_DOUBLE_EQ(kSurface->Sigma(100, 0.5), 0.20);
+  EXPECT_DOUBLE_EQ(kSurface->Sigma(120, 1.0), 0.23);
+  EXPECT_DOUBLE_EQ(kSurface->Sigma(90, 0.5), 0.25);
+  EXPECT_DOUBLE_EQ(kSurface->Sigma(90, 0.75), 0.24);
+}
+
+TEST_F(VolSurfaceSuite, ShouldHoldEdgeValuesOutsideTheGrid) {
+  const auto kSurface = Smile();
+  EXPECT_DOUBLE_EQ(kSurface->Sigma(50, 0.1), 0.30);
+  EXPECT_DOUBLE_EQ(kSurface->Sigma(500, 5.0), 0.23);
+}
+
+TEST_F(VolSurfaceSuite, ShouldFitACubicThroughTheKnots) {
+  const auto kSurface = Smile(VolSurface::Interpolation::kCubic);
+  EXPECT_DOUBLE_EQ(kSurface->Sigma(80, 0.5), 0.30);
+  EXPECT_DOUBLE_EQ(kSurface->Sigma(100, 0.5), 0.20);
+  // The spline bows below the chord between the wings and the money.
+  EXPECT_LT(kSurface->Sigma(90, 0.5), 0.25);
+  EXPECT_GT(kSurface->Sigma(90, 0.5), 0.20);
+
+  // Data linear in strike has no curvature, so the spline is the line.
+  const auto kLinear =
+      *VolSurface::Create({80, 90, 120}, {0.5, 1.0},
+                          std::vector<double>{0.28, 0.26, 0.20,  //
+                                              0.28, 0.26, 0.20},
+                          VolSurface::Interpolation::kCubic);
+  EXPECT_NEAR(kLinear->Sigma(105, 0.7), 0.23, 1e-15);
+}
+
+TEST_F(VolSurfaceSuite, ShouldLookUpAChainLikeSigma) {
+  for (const auto kInterpolation : {VolSurface::Interpolation::kBilinear,
+                                    VolSurface::Interpolation::kCubic}) {
+    const auto kSurface = Smile(kInterpolation);
+    std::vector<double> strikes, times;
+    for (int i = 0; i < 1000; ++i) {
+      strikes.push_back(70 + (0.06 * i));
+      times.push_back(0.25 + (0.001 * i));
+    }
+    std::vector<double> out(strikes.size());
+    ASSERT_TRUE(kSurface->Lookup(strikes, times, out).ok());
+    for (std::size_t i = 0; i < out.size(); ++i) {
+      EXPECT_EQ(out[i], kSurface->Sigma(strikes[i], times[i]));
+    }
+    EXPECT_EQ(kSurface->Lookup(strikes, times, std::span(out).first(3)).code(),
+              absl::StatusCode::kInvalidArgument);
+  }
+}
+
+TEST_F(VolSurfaceSuite, ShouldPriceABatchOffTheSurface) {
+  const auto kSurface = Smile();
+  const BlackScholesEngine kEngine;
+  const std::vector<double> kSpot{100, 100}, kStrike{90, 110}, kTime{0.5, 1},
+      kRate{0.01, 0.01}, kUnused;
+  const std::vector<Right> kRight{Right::kPut, Right::kCall};
+  std::vector<double> out(2);
+  ASSERT_TRUE(kSurface
+                  ->PriceBatch(kEngine,
+                               {kSpot, kStrike, kTime, kRate, kUnused, kRight},
+                               out)
+                  .ok());
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    EXPECT_NEAR(out[i],
+                kEngine.Price(kSpot[i], kStrike[i], kTime[i], kRate[i],
+                              kSurface->Sigma(kStrike[i], kTime[i]), kRight[i]),
+                1e-12);
+  }
+}
+
+TEST_F(VolSurfaceSuite, ShouldRejectMalformedGrids) {
+  const std::vector<double> kVols(4, 0.2);
+  EXPECT_EQ(VolSurface::Create({100}, {1}, std::vector<double>{0.2})
+                .status()
+                .code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(VolSurface::Create({100, 100}, {1, 2}, kVols).status().code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(VolSurface::Create({90, 100}, {1, 2, 3}, kVols).status().code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(VolSurface::Create({90, 100}, {1, 2},
+                               std::vector<double>{0.2, 0.2, 0, 0.2})
+                .status()
+                .code(),
+            absl::StatusCode::kInvalidArgument);
+}
+
+TEST_F(VolSurfaceSuite, ShouldSwapSurfacesUnderReaders) {
+  SharedVolSurface shared(Smile());
+  const std::shared_ptr<const VolSurface> kOld = shared.Load();
+  shared.Store(*VolSurface::Create({80, 120}, {0.5, 1.0},
+                                   std::vector<double>(4, 0.4)));
+  EXPECT_DOUBLE_EQ(shared.Load()->Sigma(100, 0.5), 0.4);
+  EXPECT_DOUBLE_EQ(kOld->Sigma(100, 0.5), 0.20);
+}
@@ -0,0 +1,244 @@
+#include "vol_surface.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <absl/status/status.h>
+#include <absl/status/statusor.h>
+
+namespace {
+
+// Options located per pass of Lookup; the cells for one block stay in L1.
+constexpr std::size_t kLookupBlock = 256;
+
+bool StrictlyIncreasing(const std::span<const double> kKnots) {
+  return std::ranges::adjacent_find(kKnots, std::ranges::greater_equal{}) ==
+             kKnots.end() &&
+         std::ranges::all_of(kKnots,
+                             [](const double kX) { return std::isfinite(kX); });
+}
+
+// Index of the knot interval holding kX and the position within it, held
+// to the end knots outside the grid. The search is branch-free: a chain's
+// strikes are in no useful order, so a branchy binary search mispredicts
+// about every other step.
+std::pair<std::size_t, double> Bracket(const std::span<const double> kKnots,
+                                       const double kX) {
+  const double* base = kKnots.data();
+  for (std::size_t n = kKnots.size(); n > 1;) {
+    const std::size_t kHalf = n / 2;
+    base = base[kHalf] <= kX ? base + kHalf : base;
+    n -= kHalf;
+  }
+  // Knots at or below kX, less one, kept inside [0, size - 2].
+  const std::size_t kBelow = static_cast<std::size_t>(base - kKnots.data()) +
+                             (*base <= kX ? 1 : 0);
+  const std::size_t kIndex =
+      std::clamp<std::size_t>(kBelow, 1, kKnots.size() - 1) - 1;
+  const double kWeight =
+      (kX - kKnots[kIndex]) / (kKnots[kIndex + 1] - kKnots[kIndex]);
+  return {kIndex, std::clamp(kWeight, 0.0, 1.0)};
+}
+
+}  // namespace
+
+absl::StatusOr<std::unique_ptr<VolSurface>> VolSurface::Create(
+    std::vector<double> strikes, std::vector<double> expiries,
+    const std::span<const double> kVols, const Interpolation interpolation) {
+  if (strikes.size() < 2 || expiries.size() < 2) {
+    return absl::InvalidArgumentError(
+        "surface needs at least two strikes and two expiries");
+  }
+  if (!StrictlyIncreasing(strikes) || !StrictlyIncreasing(expiries)) {
+    return absl::InvalidArgumentError(
+        "surface knots must be finite and strictly increasing");
+  }
+  if (kVols.size() != strikes.size() * expiries.size()) {
+    return absl::InvalidArgumentError("vol grid does not match its knots");
+  }
+  if (!std::ranges::all_of(kVols, [](const double kVol) {
+        return std::isfinite(kVol) && kVol > 0;
+      })) {
+    return absl::InvalidArgumentError("vols must be finite and positive");
+  }
+
+  std::unique_ptr<VolSurface> surface(
+      new VolSurface(std::move(strikes), std::move(expiries), interpolation));
+  const std::size_t kColumns = surface->strikes_.size();
+  for (std::size_t e = 0; e < surface->expiries_.size(); ++e) {
+    std::ranges::copy(kVols.subspan(e * kColumns, kColumns),
+                      &surface->vols_[e * surface->stride_]);
+  }
+  if (interpolation == Interpolation::kCubic) {
+    surface->FitSplines();
+  }
+  return surface;
+}
+
+VolSurface::VolSurface(std::vector<double> strikes,
+                       std::vector<double> expiries,
+                       const Interpolation interpolation)
+    : strikes_(std::move(strikes)),
+      expiries_(std::move(expiries)),
+      interpolation_(interpolation),
+      stride_((strikes_.size() + kLineDoubles - 1) / kLineDoubles *
+              kLineDoubles),
+      vols_(Allocate(stride_ * expiries_.size())),
+      curvature_(interpolation == Interpolation::kCubic
+                     ? Allocate(stride_ * expiries_.size())
+                     : nullptr) {}
+
+VolSurface::Grid VolSurface::Allocate(const std::size_t kSize) {
+  Grid grid(static_cast<double*>(::operator new[](
+      kSize * sizeof(double), std::align_val_t{kAlignment})));
+  std::fill_n(grid.get(), kSize, 0.0);
+  return grid;
+}
+
+// Natural cubic spline through each expiry row: the tridiagonal system for
+// the second derivatives, solved by forward elimination and back
+// substitution, with zero curvature at both end strikes.
+void VolSurface::FitSplines() {
+  const std::size_t kN = strikes_.size();
+  std::vector<double> diagonal(kN);
+  std::vector<double> rhs(kN);
+  spline_scale_.resize(kN - 1);
+  for (std::size_t i = 0; i + 1 < kN; ++i) {
+    const double kH = strikes_[i + 1] - strikes_[i];
+    spline_scale_[i] = kH * kH / 6;
+  }
+
+  for (std::size_t e = 0; e < expiries_.size(); ++e) {
+    const double* const kRow = &vols_[e * stride_];
+    double* const curvature = &curvature_[e * stride_];
+    for (std::size_t i = 1; i + 1 < kN; ++i) {
+      const double kLeft = strikes_[i] - strikes_[i - 1];
+      const double kRight = strikes_[i + 1] - strikes_[i];
+      diagonal[i] = 2 * (kLeft + kRight);
+      rhs[i] = 6 * ((kRow[i + 1] - kRow[i]) / kRight -
+                    (kRow[i] - kRow[i - 1]) / kLeft);
+      if (i > 1) {
+        const double kFactor = kLeft / diagonal[i - 1];
+        diagonal[i] -= kFactor * kLeft;
+        rhs[i] -= kFactor * rhs[i - 1];
+      }
+    }
+    curvature[0] = 0;
+    curvature[kN - 1] = 0;
+    for (std::size_t i = kN - 2; i >= 1; --i) {
+      const double kRight = strikes_[i + 1] - strikes_[i];
+      curvature[i] = (rhs[i] - kRight * curvature[i + 1]) / diagonal[i];
+    }
+  }
+}
+
+VolSurface::Cell VolSurface::Locate(const double kStrike,
+                                    const double kTime) const {
+  const auto [kStrikeIndex, kStrikeWeight] = Bracket(strikes_, kStrike);
+  const auto [kExpiryIndex, kExpiryWeight] = Bracket(expiries_, kTime);
+  return {.strike_ = kStrikeIndex,
+          .offset_ = kExpiryIndex * stride_ + kStrikeIndex,
+          .strike_weight_ = kStrikeWeight,
+          .expiry_weight_ = kExpiryWeight};
+}
+
+double VolSurface::BlendLinear(const Cell& kCell) const {
+  const double* const kNear = &vols_[kCell.offset_];
+  const double* const kFar = kNear + stride_;
+  const double kU = kCell.strike_weight_;
+  const double kNearVol = kNear[0] + (kU * (kNear[1] - kNear[0]));
+  const double kFarVol = kFar[0] + (kU * (kFar[1] - kFar[0]));
+  return kNearVol + (kCell.expiry_weight_ * (kFarVol - kNearVol));
+}
+
+double VolSurface::BlendCubic(const Cell& kCell) const {
+  const double kU = kCell.strike_weight_;
+  const double kA = 1 - kU;
+  const double kScale = spline_scale_[kCell.strike_];
+  const double kCurveA = ((kA * kA * kA) - kA) * kScale;
+  const double kCurveU = ((kU * kU * kU) - kU) * kScale;
+  const auto kRowVol = [&](const std::size_t kOffset) {
+    const double* const kVol = &vols_[kOffset];
+    const double* const kCurve = &curvature_[kOffset];
+    return (kA * kVol[0]) + (kU * kVol[1]) + (kCurveA * kCurve[0]) +
+           (kCurveU * kCurve[1]);
+  };
+  const double kNearVol = kRowVol(kCell.offset_);
+  const double kFarVol = kRowVol(kCell.offset_ + stride_);
+  return kNearVol + (kCell.expiry_weight_ * (kFarVol - kNearVol));
+}
+
+double VolSurface::Sigma(const double kStrike, const double kTime) const {
+  const Cell kCell = Locate(kStrike, kTime);
+  return interpolation_ == Interpolation::kCubic ? BlendCubic(kCell)
+                                                 : BlendLinear(kCell);
+}
+
+absl::Status VolSurface::Lookup(const std::span<const double> kStrikes,
+                                const std::span<const double> kTimes,
+                                const std::span<double> out) const {
+  if (kTimes.size() != kStrikes.size()) {
+    return absl::InvalidArgumentError("lookup spans differ in length");
+  }
+  if (out.size() != kStrikes.size()) {
+    return absl::InvalidArgumentError(
+        "output span does not match lookup size");
+  }
+
+  std::array<Cell, kLookupBlock> cells;
+  for (std::size_t begin = 0; begin < kStrikes.size();
+       begin += kLookupBlock) {
+    const std::size_t kCount = std::min(kLookupBlock, kStrikes.size() - begin);
+    for (std::size_t i = 0; i < kCount; ++i) {
+      cells[i] = Locate(kStrikes[begin + i], kTimes[begin + i]);
+    }
+    if (interpolation_ == Interpolation::kCubic) {
+      for (std::size_t i = 0; i < kCount; ++i) {
+        out[begin + i] = BlendCubic(cells[i]);
+      }
+    } else {
+      for (std::size_t i = 0; i < kCount; ++i) {
+        out[begin + i] = BlendLinear(cells[i]);
+      }
+    }
+  }
+  return absl::OkStatus();
+}
+
+absl::Status VolSurface::PriceBatch(const PriceEngine& kEngine,
+                                    OptionBatch kBatch,
+                                    const std::span<double> out) const {
+  std::vector<double> sigma(kBatch.Size());
+  kBatch.sigma_ = sigma;
+  if (auto status = kBatch.Validate(out.size()); !status.ok()) return status;
+  if (auto status = Lookup(kBatch.strike_, kBatch.time_, sigma);
+      !status.ok()) {
+    return status;
+  }
+  return kEngine.PriceBatch(kBatch, out);
+}
+
+SharedVolSurface::SharedVolSurface(std::shared_ptr<const VolSurface> surface)
+    : surface_(std::move(surface)) {}
+
+std::shared_ptr<const VolSurface> SharedVolSurface::Load() const {
+  const std::lock_guard kLock(mutex_);
+  return surface_;
+}
+
+void SharedVolSurface::Store(std::shared_ptr<const VolSurface> surface) {
+  {
+    const std::lock_guard kLock(mutex_);
+    surface_.swap(surface);
+  }
+  // surface now holds the previous one; if this was the last reference it
+  // is freed here, outside the lock.
+}
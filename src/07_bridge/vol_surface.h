@@ -0,0 +1,114 @@
+#ifndef GOF23_VOL_SURFACE_H
+#define GOF23_VOL_SURFACE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <span>
+#include <vector>
+
+#include <absl/status/status.h>
+#include <absl/status/statusor.h>
+
+#include "bridge.h"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+// Implied volatility on a strike x expiry grid. Vols are stored expiry-major
+// in one flat 64-byte aligned block, each expiry row padded to a whole
+// number of cache lines, so a lookup touches at most two rows and a chain
+// at one expiry walks them in order. Between expiries the surface is linear;
+// across strikes it is linear or a natural cubic spline. Outside the grid
+// the nearest edge value is held flat.
+//
+// Immutable once built, so one surface can be read from any number of
+// threads; publish new ones through SharedVolSurface.
+class VolSurface {
+ public:
+  enum class Interpolation : uint8_t { kBilinear, kCubic };
+
+  // kVols is expiry-major: kVols[e * kStrikes.size() + k] is the vol at
+  // kExpiries[e] and kStrikes[k]. Both axes need at least two strictly
+  // increasing knots and every vol must be positive.
+  static absl::StatusOr<std::unique_ptr<VolSurface>> Create(
+      std::vector<double> strikes, std::vector<double> expiries,
+      std::span<const double> kVols,
+      Interpolation interpolation = Interpolation::kBilinear);
+
+  [[nodiscard]] double Sigma(double kStrike, double kTime) const;
+
+  // Sigma for every (kStrikes[i], kTimes[i]) pair. Knots are located for a
+  // block of options first and the blend then runs over the block as one
+  // branch-free loop.
+  absl::Status Lookup(std::span<const double> kStrikes,
+                      std::span<const double> kTimes,
+                      std::span<double> out) const;
+
+  // Prices kBatch off this surface: kBatch.sigma_ is ignored and replaced
+  // by the surface vol at each option's strike and time.
+  absl::Status PriceBatch(const PriceEngine& kEngine, OptionBatch kBatch,
+                          std::span<double> out) const;
+
+  [[nodiscard]] std::span<const double> Strikes() const { return strikes_; }
+  [[nodiscard]] std::span<const double> Expiries() const { return expiries_; }
+
+ private:
+  static constexpr std::size_t kAlignment = 64;
+  static constexpr std::size_t kLineDoubles = kAlignment / sizeof(double);
+
+  struct AlignedDelete {
+    void operator()(double* grid) const {
+      ::operator delete[](grid, std::align_val_t{kAlignment});
+    }
+  };
+  using Grid = std::unique_ptr<double[], AlignedDelete>;
+  static Grid Allocate(std::size_t kSize);
+
+  VolSurface(std::vector<double> strikes, std::vector<double> expiries,
+             Interpolation interpolation);
+  void FitSplines();
+
+  // Where one option falls: its strike interval, the offset of its
+  // lower-left knot in the grid and its fractional position towards the
+  // next knot on each axis.
+  struct Cell {
+    std::size_t strike_;
+    std::size_t offset_;
+    double strike_weight_;
+    double expiry_weight_;
+  };
+  [[nodiscard]] Cell Locate(double kStrike, double kTime) const;
+  [[nodiscard]] double BlendLinear(const Cell& kCell) const;
+  [[nodiscard]] double BlendCubic(const Cell& kCell) const;
+
+  std::vector<double> strikes_;
+  std::vector<double> expiries_;
+  Interpolation interpolation_;
+  std::size_t stride_;  // doubles per expiry row, padded to a cache line
+  Grid vols_;
+  Grid curvature_;  // spline second derivatives in strike, kCubic only
+  std::vector<double> spline_scale_;  // h * h / 6 per strike interval
+};
+
+// Holder for the surface in use. A rebuild happens wherever the caller
+// likes; Store then swaps it in under a lock, and a reader that has Loaded
+// the previous surface keeps it alive until it lets go. The lock covers
+// only the pointer copy, never a rebuild or a Sigma lookup.
+class SharedVolSurface {
+ public:
+  SharedVolSurface() = default;
+  explicit SharedVolSurface(std::shared_ptr<const VolSurface> surface);
+
+  [[nodiscard]] std::shared_ptr<const VolSurface> Load() const;
+  void Store(std::shared_ptr<const VolSurface> surface);
+
+ private:
+  mutable std::mutex mutex_;
+  std::shared_ptr<const VolSurface> surface_;
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_VOL_SURFACE_H
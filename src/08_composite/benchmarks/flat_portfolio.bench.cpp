@@ -0,0 +1,58 @@
+#include "flat_portfolio.h"
+
+#include <cstddef>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "composite.h"
+#include "parallel_rollup.h"
+#include "random_book.h"
+
+namespace {
+
+void SetLeavesPerSecond(benchmark::State& state) {
+  state.counters["leaves/s"] =
+      benchmark::Counter(static_cast<double>(state.range(0)),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Portfolio::NetCost is a cached read, so the pointer-tree baseline is a
+// serial walk over the leaves.
+void BM_PointerTreeNetCost(benchmark::State& state) {
+  const auto kBook = MakeRandomBook(static_cast<std::size_t>(state.range(0)));
+  ParallelRollup::Options options;
+  options.threads_ = 1;
+  ParallelRollup walk(options);
+  for (auto _ : state) benchmark::DoNotOptimize(walk.NetCost(*kBook));
+  SetLeavesPerSecond(state);
+}
+
+void BM_FlatNetCost(benchmark::State& state) {
+  const auto kFlat = *FlatPortfolio::Compile(
+      *MakeRandomBook(static_cast<std::size_t>(state.range(0))));
+  for (auto _ : state) benchmark::DoNotOptimize(kFlat.NetCost());
+  SetLeavesPerSecond(state);
+}
+
+void BM_FlatSubtreeTotals(benchmark::State& state) {
+  const auto kFlat = *FlatPortfolio::Compile(
+      *MakeRandomBook(static_cast<std::size_t>(state.range(0))));
+  for (auto _ : state) benchmark::DoNotOptimize(kFlat.SubtreeTotals());
+  SetLeavesPerSecond(state);
+}
+
+void BM_Compile(benchmark::State& state) {
+  const auto kBook = MakeRandomBook(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(FlatPortfolio::Compile(*kBook));
+  }
+  SetLeavesPerSecond(state);
+}
+
+}  // namespace
+
+BENCHMARK(BM_PointerTreeNetCost)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+BENCHMARK(BM_FlatNetCost)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+BENCHMARK(BM_FlatSubtreeTotals)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+BENCHMARK(BM_Compile)->Arg(1 << 20);
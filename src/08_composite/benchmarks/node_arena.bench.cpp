@@ -0,0 +1,105 @@
+#include "node_arena.h"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+#include <benchmark/benchmark.h>
+
+#include "composite.h"
+#include "random_book.h"
+
+namespace {
+
+void SetNodesPerSecond(benchmark::State& state, const std::size_t kNodes) {
+  state.counters["nodes/s"] = benchmark::Counter(
+      static_cast<double>(kNodes),
+      benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// A book built and torn down node by node on the heap.
+void BM_HeapBuildAndDestroy(benchmark::State& state) {
+  const auto kStocks = static_cast<std::size_t>(state.range(0));
+  std::size_t nodes = 0;
+  for (auto _ : state) {
+    std::unique_ptr<RiskNode> book = MakeRandomBook(kStocks);
+    nodes = book->SubtreeSize();
+    book.reset();
+  }
+  SetNodesPerSecond(state, nodes);
+}
+
+// The same book in one arena: destructors still run, but the memory goes
+// back in a handful of blocks when the arena does.
+void BM_ArenaBuildAndDestroy(benchmark::State& state) {
+  const auto kStocks = static_cast<std::size_t>(state.range(0));
+  std::size_t nodes = 0;
+  for (auto _ : state) {
+    std::optional<NodeArena> arena(std::in_place);
+    std::unique_ptr<RiskNode> book = MakeRandomBook(kStocks, &*arena);
+    nodes = book->SubtreeSize();
+    book.reset();
+    arena.reset();
+  }
+  SetNodesPerSecond(state, nodes);
+}
+
+// Build time alone; teardown is left out of the timing.
+void BM_HeapBuild(benchmark::State& state) {
+  const auto kStocks = static_cast<std::size_t>(state.range(0));
+  std::size_t nodes = 0;
+  for (auto _ : state) {
+    std::unique_ptr<RiskNode> book = MakeRandomBook(kStocks);
+    nodes = book->SubtreeSize();
+    state.PauseTiming();
+    book.reset();
+    state.ResumeTiming();
+  }
+  SetNodesPerSecond(state, nodes);
+}
+
+void BM_ArenaBuild(benchmark::State& state) {
+  const auto kStocks = static_cast<std::size_t>(state.range(0));
+  std::size_t nodes = 0;
+  for (auto _ : state) {
+    std::optional<NodeArena> arena(std::in_place);
+    std::unique_ptr<RiskNode> book = MakeRandomBook(kStocks, &*arena);
+    nodes = book->SubtreeSize();
+    state.PauseTiming();
+    book.reset();
+    arena.reset();
+    state.ResumeTiming();
+  }
+  SetNodesPerSecond(state, nodes);
+}
+
+// ToString visits every node, so it shows what packing them in build order
+// does for a traversal. (NetCost is cached and would not.)
+void BM_HeapWalk(benchmark::State& state) {
+  const auto kBook = MakeRandomBook(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) benchmark::DoNotOptimize(kBook->ToString().size());
+  SetNodesPerSecond(state, kBook->SubtreeSize());
+}
+
+void BM_ArenaWalk(benchmark::State& state) {
+  NodeArena arena;
+  const auto kBook =
+      MakeRandomBook(static_cast<std::size_t>(state.range(0)), &arena);
+  for (auto _ : state) benchmark::DoNotOptimize(kBook->ToString().size());
+  SetNodesPerSecond(state, kBook->SubtreeSize());
+}
+
+}  // namespace
+
+BENCHMARK(BM_HeapBuildAndDestroy)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ArenaBuildAndDestroy)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_HeapBuild)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ArenaBuild)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_HeapWalk)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ArenaWalk)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
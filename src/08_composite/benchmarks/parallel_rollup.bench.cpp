@@ -0,0 +1,41 @@
+#include "parallel_rollup.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include "composite.h"
+#include "random_book.h"
+
+namespace {
+
+constexpr std::size_t kStocks = 1 << 20;
+
+const RiskNode& SharedBook() {
+  static const std::unique_ptr<RiskNode> kBook = MakeRandomBook(kStocks);
+  return *kBook;
+}
+
+void BM_RollupNetCost(benchmark::State& state) {
+  const RiskNode& kBook = SharedBook();
+  ParallelRollup::Options options;
+  options.threads_ = static_cast<unsigned>(state.range(0));
+  ParallelRollup rollup(options);
+  for (auto _ : state) benchmark::DoNotOptimize(rollup.NetCost(kBook));
+  state.counters["leaves/s"] =
+      benchmark::Counter(static_cast<double>(kStocks),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+const int kMaxThreads =
+    static_cast<int>(std::max(1U, std::thread::hardware_concurrency()));
+
+}  // namespace
+
+BENCHMARK(BM_RollupNetCost)
+    ->DenseRange(1, std::max(kMaxThreads, 2))
+    ->ArgName("threads")
+    ->UseRealTime();
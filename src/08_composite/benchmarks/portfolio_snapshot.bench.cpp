@@ -0,0 +1,76 @@
+#include "portfolio_snapshot.h"
+
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "composite.h"
+#include "node_arena.h"
+#include "random_book.h"
+
+namespace {
+
+constexpr std::size_t kStocks = 1 << 20;
+
+// The image of the shared 1M-stock book, written once per run.
+const std::string& SnapshotPath() {
+  static const std::string kPath = [] {
+    std::string path = "/tmp/gof23_portfolio.snapshot";
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    (void)PortfolioSnapshot::Write(*MakeRandomBook(kStocks), file);
+    return path;
+  }();
+  return kPath;
+}
+
+void SetNodesPerSecond(benchmark::State& state, const std::size_t kNodes) {
+  state.counters["nodes/s"] = benchmark::Counter(
+      static_cast<double>(kNodes),
+      benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Startup as it is today: the tree rebuilt node by node from source data.
+void BM_RebuildTree(benchmark::State& state) {
+  std::size_t nodes = 0;
+  for (auto _ : state) {
+    const auto kBook = MakeRandomBook(kStocks);
+    benchmark::DoNotOptimize(kBook->NetCost());
+    nodes = kBook->SubtreeSize();
+  }
+  SetNodesPerSecond(state, nodes);
+}
+
+// Map and check the image, then answer the first question from it.
+void BM_OpenSnapshot(benchmark::State& state) {
+  const std::string& kPath = SnapshotPath();
+  std::size_t nodes = 0;
+  for (auto _ : state) {
+    const auto kSnapshot = std::move(PortfolioSnapshot::Open(kPath)).value();
+    benchmark::DoNotOptimize(kSnapshot->NetCost());
+    nodes = kSnapshot->NodeCount();
+  }
+  SetNodesPerSecond(state, nodes);
+}
+
+// Map the image and rebuild a live, mutable tree from it in an arena.
+void BM_MaterializeSnapshot(benchmark::State& state) {
+  const std::string& kPath = SnapshotPath();
+  std::size_t nodes = 0;
+  for (auto _ : state) {
+    const auto kSnapshot = std::move(PortfolioSnapshot::Open(kPath)).value();
+    NodeArena arena;
+    const auto kBook = std::move(kSnapshot->Materialize(&arena)).value();
+    benchmark::DoNotOptimize(kBook->NetCost());
+    nodes = kBook->SubtreeSize();
+  }
+  SetNodesPerSecond(state, nodes);
+}
+
+}  // namespace
+
+BENCHMARK(BM_RebuildTree)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_OpenSnapshot)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MaterializeSnapshot)->Unit(benchmark::kMillisecond);
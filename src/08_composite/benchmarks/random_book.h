@@ -0,0 +1,69 @@
+#ifndef GOF23_COMPOSITE_RANDOM_BOOK_H
+#define GOF23_COMPOSITE_RANDOM_BOOK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <utility>
+
+#include <absl/strings/str_cat.h>
+
+#include "composite.h"
+#include "node_arena.h"
+
+// Symbols the random books draw their stocks from.
+inline constexpr int kRandomBookSymbols = 4096;
+
+// A reproducible firm-wide book shared by the composite benchmarks:
+// kDesks desks of kStrategiesPerDesk strategies with kStocks stocks spread
+// over the strategies, each holding one of kRandomBookSymbols symbols.
+// Leaves are allocated one by one, as a real book is built, so they are
+// scattered over the heap, or packed in build order when an arena is given.
+inline std::unique_ptr<RiskNode> MakeRandomBook(
+    const std::size_t kStocks, NodeArena* arena = nullptr,
+    const int kDesks = 16, const int kStrategiesPerDesk = 64) {
+  std::mt19937_64 rng(kStocks);
+  std::uniform_int_distribution<uint32_t> quantity(1, 1000);
+  std::uniform_real_distribution<double> price(1, 500);
+  std::uniform_int_distribution<int> symbol(0, kRandomBookSymbols - 1);
+  const std::size_t kPerStrategy =
+      kStocks / static_cast<std::size_t>(kDesks * kStrategiesPerDesk);
+
+  const auto kPortfolio = [arena]() -> std::unique_ptr<RiskNode> {
+    return std::move(arena != nullptr ? Portfolio::Create(*arena)
+                                      : Portfolio::Create())
+        .value();
+  };
+  const auto kStock = [arena](const int kSymbol, const uint32_t kQuantity,
+                              const double kPrice)
+      -> std::unique_ptr<RiskNode> {
+    Ticker ticker{absl::StrCat("S", kSymbol), "Symbol"};
+    return std::move(arena != nullptr
+                         ? Stock::Create(*arena, std::move(ticker), kQuantity,
+                                         kPrice)
+                         : Stock::Create(std::move(ticker), kQuantity, kPrice))
+        .value();
+  };
+
+  std::unique_ptr<RiskNode> root = kPortfolio();
+  for (int d = 0; d < kDesks; ++d) {
+    std::unique_ptr<RiskNode> desk = kPortfolio();
+    for (int s = 0; s < kStrategiesPerDesk; ++s) {
+      std::unique_ptr<RiskNode> strategy = kPortfolio();
+      for (std::size_t i = 0; i < kPerStrategy; ++i) {
+        // Drawn into locals so the sequence does not depend on the order
+        // arguments are evaluated in.
+        const int kSymbol = symbol(rng);
+        const uint32_t kQuantity = quantity(rng);
+        const double kPrice = price(rng);
+        (void)strategy->Add(kStock(kSymbol, kQuantity, kPrice));
+      }
+      (void)desk->Add(std::move(strategy));
+    }
+    (void)root->Add(std::move(desk));
+  }
+  return root;
+}
+
+#endif  // GOF23_COMPOSITE_RANDOM_BOOK_H
@@ -0,0 +1,76 @@
+#include "risk_visitor.h"
+
+#include <cstddef>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "composite.h"
+#include "random_book.h"
+
+namespace {
+
+constexpr std::size_t kStocks = 1 << 20;
+
+const RiskNode& SharedBook() {
+  static const std::unique_ptr<RiskNode> kBook = MakeRandomBook(kStocks);
+  return *kBook;
+}
+
+void SetLeavesPerSecond(benchmark::State& state) {
+  state.counters["leaves/s"] =
+      benchmark::Counter(static_cast<double>(kStocks),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Each metric computed the way NetCost used to be: its own walk of the
+// whole tree.
+void BM_SeparateWalks(benchmark::State& state) {
+  const RiskNode& kBook = SharedBook();
+  for (auto _ : state) {
+    NetCostVisitor net_cost;
+    GrossExposureVisitor gross;
+    PositionCountVisitor positions;
+    SymbolTotalsVisitor symbols;
+    WalkRiskTree(kBook, net_cost);
+    WalkRiskTree(kBook, gross);
+    WalkRiskTree(kBook, positions);
+    WalkRiskTree(kBook, symbols);
+    benchmark::DoNotOptimize(net_cost.Total() + gross.Total());
+    benchmark::DoNotOptimize(positions.Count() + symbols.Totals().size());
+  }
+  SetLeavesPerSecond(state);
+}
+
+// The same four metrics from one walk through a VisitorGroup.
+void BM_FusedWalk(benchmark::State& state) {
+  const RiskNode& kBook = SharedBook();
+  for (auto _ : state) {
+    NetCostVisitor net_cost;
+    GrossExposureVisitor gross;
+    PositionCountVisitor positions;
+    SymbolTotalsVisitor symbols;
+    VisitorGroup group({&net_cost, &gross, &positions, &symbols});
+    WalkRiskTree(kBook, group);
+    benchmark::DoNotOptimize(net_cost.Total() + gross.Total());
+    benchmark::DoNotOptimize(positions.Count() + symbols.Totals().size());
+  }
+  SetLeavesPerSecond(state);
+}
+
+// One metric, for the cost of the walk itself.
+void BM_SingleWalk(benchmark::State& state) {
+  const RiskNode& kBook = SharedBook();
+  for (auto _ : state) {
+    NetCostVisitor net_cost;
+    WalkRiskTree(kBook, net_cost);
+    benchmark::DoNotOptimize(net_cost.Total());
+  }
+  SetLeavesPerSecond(state);
+}
+
+}  // namespace
+
+BENCHMARK(BM_SeparateWalks)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FusedWalk)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SingleWalk)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,140 @@
+#include "scenario_engine.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "../helpers/SimdLanes.h"
+#include "composite.h"
+#include "random_book.h"
+
+namespace {
+
+constexpr std::size_t kStocks = 1 << 20;
+
+std::unique_ptr<RiskNode>& SharedBook() {
+  static std::unique_ptr<RiskNode> book = MakeRandomBook(kStocks);
+  return book;
+}
+
+const ScenarioEngine& SharedEngine() {
+  static const ScenarioEngine kEngine =
+      ScenarioEngine::Create(*SharedBook()).value();
+  return kEngine;
+}
+
+std::vector<double> RandomShocks(const std::size_t kScenarios) {
+  std::mt19937_64 rng(kScenarios);
+  std::uniform_real_distribution<double> shock(-0.2, 0.2);
+  std::vector<double> shocks(kScenarios * SharedEngine().SymbolCount());
+  for (double& value : shocks) value = shock(rng);
+  return shocks;
+}
+
+void SetScenariosPerSecond(benchmark::State& state,
+                           const std::size_t kScenarios) {
+  state.counters["scenarios/s"] =
+      benchmark::Counter(static_cast<double>(kScenarios),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+std::vector<Stock*> Leaves(RiskNode& root) {
+  std::vector<Stock*> leaves;
+  std::vector<RiskNode*> pending{&root};
+  while (!pending.empty()) {
+    RiskNode* node = pending.back();
+    pending.pop_back();
+    if (const Portfolio* portfolio = AsPortfolio(*node)) {
+      for (const auto& child : portfolio->Children()) {
+        pending.push_back(child.get());
+      }
+    } else {
+      leaves.push_back(static_cast<Stock*>(node));
+    }
+  }
+  return leaves;
+}
+
+// What a scenario costs today: reprice every stock in place, read the
+// cached NetCost, then put the prices back.
+void BM_MutateTree(benchmark::State& state) {
+  const auto kScenarios = static_cast<std::size_t>(state.range(0));
+  const ScenarioEngine& kEngine = SharedEngine();
+  const std::vector<double> kShocks = RandomShocks(kScenarios);
+  const std::vector<Stock*> kLeaves = Leaves(*SharedBook());
+  std::vector<std::size_t> columns;
+  std::vector<double> prices;
+  for (const Stock* stock : kLeaves) {
+    columns.push_back(kEngine.Column(stock->GetTicker().Symbol()).value());
+    prices.push_back(stock->Price());
+  }
+  const std::size_t kColumns = kEngine.SymbolCount();
+
+  for (auto _ : state) {
+    for (std::size_t s = 0; s < kScenarios; ++s) {
+      const double* const kRow = kShocks.data() + (s * kColumns);
+      for (std::size_t i = 0; i < kLeaves.size(); ++i) {
+        (void)kLeaves[i]->SetPrice(prices[i] * (1 + kRow[columns[i]]));
+      }
+      benchmark::DoNotOptimize(SharedBook()->NetCost());
+    }
+    for (std::size_t i = 0; i < kLeaves.size(); ++i) {
+      (void)kLeaves[i]->SetPrice(prices[i]);
+    }
+  }
+  SetScenariosPerSecond(state, kScenarios);
+}
+
+// Leaves laid out contiguously but not collapsed by symbol: each scenario
+// is a scan of every leaf, gathering its shock through the symbol column.
+void BM_LeafScan(benchmark::State& state) {
+  const auto kScenarios = static_cast<std::size_t>(state.range(0));
+  const ScenarioEngine& kEngine = SharedEngine();
+  const std::vector<double> kShocks = RandomShocks(kScenarios);
+  std::vector<uint32_t> columns;
+  std::vector<double> values;
+  for (const Stock* stock : Leaves(*SharedBook())) {
+    columns.push_back(static_cast<uint32_t>(
+        kEngine.Column(stock->GetTicker().Symbol()).value()));
+    values.push_back(stock->Quantity() * stock->Price());
+  }
+  const std::size_t kColumns = kEngine.SymbolCount();
+  std::vector<double> out(kScenarios);
+
+  for (auto _ : state) {
+    for (std::size_t s = 0; s < kScenarios; ++s) {
+      const double* const kRow = kShocks.data() + (s * kColumns);
+      double total = 0;
+      for (std::size_t i = 0; i < values.size(); ++i) {
+        total += values[i] * (1 + kRow[columns[i]]);
+      }
+      out[s] = total;
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  SetScenariosPerSecond(state, kScenarios);
+}
+
+void BM_ScenarioEngine(benchmark::State& state) {
+  const auto kScenarios = static_cast<std::size_t>(state.range(0));
+  const ScenarioEngine& kEngine = SharedEngine();
+  const std::vector<double> kShocks = RandomShocks(kScenarios);
+  std::vector<double> out(kScenarios);
+  for (auto _ : state) {
+    (void)kEngine.Evaluate(kShocks, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  SetScenariosPerSecond(state, kScenarios);
+  state.SetLabel(NativeLanes::kName);
+}
+
+}  // namespace
+
+BENCHMARK(BM_MutateTree)->Arg(8)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LeafScan)->Arg(64)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ScenarioEngine)->Arg(64)->Arg(512)->Unit(benchmark::kMicrosecond);
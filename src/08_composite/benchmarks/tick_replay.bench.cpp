@@ -0,0 +1,118 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "composite.h"
+
+namespace {
+
+constexpr int kDesks = 16;
+constexpr int kStrategiesPerDesk = 64;
+constexpr std::size_t kTicks = 1 << 16;
+
+// kDesks desks of kStrategiesPerDesk strategies sharing range(0) stocks,
+// plus a replay of kTicks random price updates against them.
+struct Book {
+  explicit Book(const std::size_t kStocks) {
+    std::mt19937_64 rng(kStocks);
+    std::uniform_int_distribution<uint32_t> quantity(1, 1000);
+    std::uniform_real_distribution<double> price(1, 500);
+    const std::size_t kPerStrategy = kStocks / (kDesks * kStrategiesPerDesk);
+
+    root_ = std::move(Portfolio::Create()).value();
+    for (int d = 0; d < kDesks; ++d) {
+      std::unique_ptr<RiskNode> desk = std::move(Portfolio::Create()).value();
+      for (int s = 0; s < kStrategiesPerDesk; ++s) {
+        std::unique_ptr<RiskNode> strategy =
+            std::move(Portfolio::Create()).value();
+        for (std::size_t i = 0; i < kPerStrategy; ++i) {
+          auto stock = std::move(Stock::Create(Ticker{"SYM", "Symbol"},
+                                               quantity(rng), price(rng)))
+                           .value();
+          stocks_.push_back(stock.get());
+          (void)strategy->Add(std::move(stock));
+        }
+        (void)desk->Add(std::move(strategy));
+      }
+      (void)root_->Add(std::move(desk));
+    }
+
+    std::uniform_int_distribution<std::size_t> pick(0, stocks_.size() - 1);
+    for (std::size_t t = 0; t < kTicks; ++t) {
+      ticks_.push_back({stocks_[pick(rng)], price(rng)});
+    }
+  }
+
+  struct Tick {
+    Stock* stock_;
+    double price_;
+  };
+
+  std::unique_ptr<Portfolio> root_;
+  std::vector<Stock*> stocks_;
+  std::vector<Tick> ticks_;
+};
+
+// NetCost the way Portfolio computed it before totals were cached: a walk
+// over the whole tree.
+double WalkNetCost(const RiskNode& kNode) {
+  const auto* portfolio = dynamic_cast<const Portfolio*>(&kNode);
+  if (portfolio == nullptr) return kNode.NetCost();
+  double sum = 0;
+  for (const auto& child : portfolio->Children()) sum += WalkNetCost(*child);
+  return sum;
+}
+
+void SetTicksPerSecond(benchmark::State& state) {
+  state.counters["ticks/s"] =
+      benchmark::Counter(static_cast<double>(kTicks),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Tick, then read the root: with cached totals each step is O(depth).
+void BM_UpdateAndRead(benchmark::State& state) {
+  Book book(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    for (const Book::Tick& kTick : book.ticks_) {
+      (void)kTick.stock_->SetPrice(kTick.price_);
+      benchmark::DoNotOptimize(book.root_->NetCost());
+    }
+  }
+  SetTicksPerSecond(state);
+}
+
+void BM_Update(benchmark::State& state) {
+  Book book(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    for (const Book::Tick& kTick : book.ticks_) {
+      benchmark::DoNotOptimize(kTick.stock_->SetPrice(kTick.price_));
+    }
+  }
+  SetTicksPerSecond(state);
+}
+
+// The same replay with the root re-walked after every tick, as before.
+// Only the first 64 ticks are replayed: a full walk per tick is slow.
+void BM_UpdateAndWalk(benchmark::State& state) {
+  Book book(static_cast<std::size_t>(state.range(0)));
+  constexpr std::size_t kWalkTicks = 64;
+  for (auto _ : state) {
+    for (std::size_t t = 0; t < kWalkTicks; ++t) {
+      (void)book.ticks_[t].stock_->SetPrice(book.ticks_[t].price_);
+      benchmark::DoNotOptimize(WalkNetCost(*book.root_));
+    }
+  }
+  state.counters["ticks/s"] =
+      benchmark::Counter(static_cast<double>(kWalkTicks),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+}  // namespace
+
+BENCHMARK(BM_UpdateAndRead)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+BENCHMARK(BM_Update)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+BENCHMARK(BM_UpdateAndWalk)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
@@ -0,0 +1,66 @@
+#include "ticker_registry.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "composite.h"
+#include "node_arena.h"
+#include "random_book.h"
+
+namespace {
+
+constexpr std::size_t kStocks = 1 << 20;
+
+// Memory held by a 1M-stock book: the nodes, counted exactly by building
+// them in an arena, and the shared tickers they point at. The time is that
+// of the build.
+void BM_BookFootprint(benchmark::State& state) {
+  for (auto _ : state) {
+    NodeArena arena;
+    auto book = MakeRandomBook(kStocks, &arena);
+    state.PauseTiming();
+    const double kNodeBytes = static_cast<double>(arena.BytesAllocated());
+    const double kTickerBytes =
+        static_cast<double>(TickerRegistry::Global().BytesUsed());
+    state.counters["node_MB"] = kNodeBytes / 1e6;
+    state.counters["ticker_MB"] = kTickerBytes / 1e6;
+    state.counters["bytes/node"] =
+        (kNodeBytes + kTickerBytes) / static_cast<double>(book->SubtreeSize());
+    state.counters["sizeof(Stock)"] = sizeof(Stock);
+    book.reset();
+    state.ResumeTiming();
+  }
+}
+
+// Stocks are smaller now, so more of them share each cache line on a walk.
+void BM_ArenaNetCostWalk(benchmark::State& state) {
+  NodeArena arena;
+  const auto kBook = MakeRandomBook(kStocks, &arena);
+  for (auto _ : state) {
+    double total = 0;
+    std::vector<const RiskNode*> pending{kBook.get()};
+    while (!pending.empty()) {
+      const RiskNode* node = pending.back();
+      pending.pop_back();
+      if (const Portfolio* portfolio = AsPortfolio(*node)) {
+        for (const auto& child : portfolio->Children()) {
+          pending.push_back(child.get());
+        }
+      } else {
+        total += node->NetCost();
+      }
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.counters["leaves/s"] =
+      benchmark::Counter(static_cast<double>(kStocks),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+}  // namespace
+
+BENCHMARK(BM_BookFootprint)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ArenaNetCostWalk)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,77 @@
+#include "tree_writer.h"
+
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "composite.h"
+#include "random_book.h"
+
+namespace {
+
+// About 1M nodes: 1M stocks plus 1,041 portfolios.
+constexpr std::size_t kStocks = 1 << 20;
+
+const RiskNode& SharedBook() {
+  static const std::unique_ptr<RiskNode> kBook = MakeRandomBook(kStocks);
+  return *kBook;
+}
+
+void SetNodesPerSecond(benchmark::State& state) {
+  state.counters["nodes/s"] = benchmark::Counter(
+      static_cast<double>(SharedBook().SubtreeSize()),
+      benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Portfolio::ToString as it was: every child's string built, concatenated
+// with a newline into a temporary, then appended.
+std::string LegacyToString(const RiskNode& kNode) {
+  const Portfolio* portfolio = AsPortfolio(kNode);
+  if (portfolio == nullptr) return kNode.ToString();
+  std::string result = "Portfolio:\n";
+  for (const auto& node : portfolio->Children()) {
+    result += LegacyToString(*node) + '\n';
+  }
+  return result;
+}
+
+void BM_LegacyToString(benchmark::State& state) {
+  for (auto _ : state) benchmark::DoNotOptimize(LegacyToString(SharedBook()));
+  SetNodesPerSecond(state);
+}
+
+void BM_ToString(benchmark::State& state) {
+  for (auto _ : state) benchmark::DoNotOptimize(SharedBook().ToString());
+  SetNodesPerSecond(state);
+}
+
+// A reconciliation loop dumping into the same buffer each time.
+void BM_AppendReusedBuffer(benchmark::State& state) {
+  const TreeWriter kWriter;
+  std::string out;
+  for (auto _ : state) {
+    out.clear();
+    kWriter.Append(SharedBook(), out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  SetNodesPerSecond(state);
+}
+
+void BM_WriteToFile(benchmark::State& state) {
+  TreeWriter writer;
+  std::ofstream sink("/dev/null");
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(writer.Write(SharedBook(), sink));
+  }
+  SetNodesPerSecond(state);
+}
+
+}  // namespace
+
+BENCHMARK(BM_LegacyToString);
+BENCHMARK(BM_ToString);
+BENCHMARK(BM_AppendReusedBuffer);
+BENCHMARK(BM_WriteToFile);
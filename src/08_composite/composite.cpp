@@ -4,10 +4,46 @@
 
 #include "composite.h"
 
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <new>
 #include <ostream>
 #include <string>
 #include <utility>
 
+#include "node_arena.h"
+#include "risk_visitor.h"
+#include "ticker_registry.h"
+
+namespace {
+
+#ifdef NDEBUG
+// The strictest alignment an object of size bytes can need: the largest
+// power of two dividing size, capped where operator new's guarantee stops.
+// Packs 40-byte Stocks at 8 rather than 16.
+std::size_t NodeAlignment(const std::size_t kSize) {
+  return std::min(kSize & (~kSize + 1), alignof(std::max_align_t));
+}
+#else
+// Debug builds put the owning arena in front of each arena node, so delete
+// can report the node gone and ~NodeArena can catch one that outlives it.
+struct alignas(alignof(std::max_align_t)) ArenaHeader {
+  NodeArena* arena_;
+};
+#endif
+
+// A non-finite price would poison every cached total above it for good:
+// once an ancestor holds NaN, no later delta can bring it back.
+absl::Status CheckPrice(const double kPrice) {
+  if (std::isfinite(kPrice)) return absl::OkStatus();
+  return absl::InvalidArgumentError("price must be finite");
+}
+
+}  // namespace
+
 Ticker::Ticker(std::string symbol, std::string name)
     : symbol_(std::move(symbol)), name_(std::move(name)) {}
 
@@ -19,10 +55,67 @@ absl::Status RiskNode::Add(std::unique_ptr<RiskNode> /*unused*/) {
   return absl::FailedPreconditionError("node is not a composite");
 }
 
+void* RiskNode::operator new(const std::size_t size, NodeArena& arena) {
+#ifndef NDEBUG
+  auto* header = static_cast<ArenaHeader*>(
+      arena.Allocate(sizeof(ArenaHeader) + size, alignof(ArenaHeader)));
+  header->arena_ = &arena;
+  arena.NodeCreated();
+  return header + 1;
+#else
+  return arena.Allocate(size, NodeAlignment(size));
+#endif
+}
+
+void RiskNode::operator delete(RiskNode* node, std::destroying_delete_t) {
+  const bool kInArena = node->in_arena_;
+  void* const kBlock = dynamic_cast<void*>(node);
+#ifndef NDEBUG
+  NodeArena* const kArena =
+      kInArena ? (static_cast<ArenaHeader*>(kBlock) - 1)->arena_ : nullptr;
+#endif
+  node->~RiskNode();
+  // Arena memory is released with the arena.
+  if (!kInArena) {
+    ::operator delete(kBlock);
+    return;
+  }
+#ifndef NDEBUG
+  kArena->NodeDestroyed();
+#endif
+}
+
+void RiskNode::operator delete(void* /*node*/, NodeArena& /*arena*/) {}
+
+void RiskNode::AppendTo(std::string& out) const { out += ToString(); }
+
+void RiskNode::Accept(RiskVisitor& visitor) const { visitor.VisitOther(*this); }
+
+void RiskNode::PropagateNetCostDelta(const double kDelta) const {
+  for (Portfolio* node = parent_; node != nullptr; node = node->parent_) {
+    node->net_cost_ += kDelta;
+  }
+}
+
 absl::StatusOr<std::unique_ptr<Stock>> Stock::Create(Ticker ticker,
                                                      const uint32_t kQuantity,
                                                      const double kPrice) {
-  return std::make_unique<Stock>(Stock{std::move(ticker), kQuantity, kPrice});
+  if (auto status = CheckPrice(kPrice); !status.ok()) return status;
+  auto id_or = TickerRegistry::Global().Intern(ticker);
+  if (!id_or.ok()) return id_or.status();
+  return std::make_unique<Stock>(Stock{*id_or, kQuantity, kPrice});
+}
+
+absl::StatusOr<std::unique_ptr<Stock>> Stock::Create(NodeArena& arena,
+                                                     Ticker ticker,
+                                                     const uint32_t kQuantity,
+                                                     const double kPrice) {
+  if (auto status = CheckPrice(kPrice); !status.ok()) return status;
+  auto id_or = TickerRegistry::Global().Intern(ticker);
+  if (!id_or.ok()) return id_or.status();
+  auto* stock = new (arena) Stock(*id_or, kQuantity, kPrice);
+  stock->MarkInArena();
+  return std::unique_ptr<Stock>(stock);
 }
 
 double Stock::NetCost() const {
@@ -30,38 +123,101 @@ double Stock::NetCost() const {
 }
 
 std::string Stock::ToString() const {
-  return absl::StrFormat("%s (%s) @ $%.4f x %u", ticker_.Name(),
-                         ticker_.Symbol(), price_, quantity_);
+  std::string result;
+  AppendTo(result);
+  return result;
+}
+
+// Same text as StrFormat("%s (%s) @ $%.4f x %u"), but std::to_chars skips
+// the printf machinery, which dominated dumps of large books.
+void Stock::AppendTo(std::string& out) const {
+  char number[64];
+  const Ticker& kTicker = GetTicker();
+  out += kTicker.Name();
+  out += " (";
+  out += kTicker.Symbol();
+  out += ") @ $";
+  out.append(number, std::to_chars(number, std::end(number), price_,
+                                   std::chars_format::fixed, 4)
+                         .ptr);
+  out += " x ";
+  out.append(number, std::to_chars(number, std::end(number), quantity_).ptr);
+}
+
+void Stock::Accept(RiskVisitor& visitor) const { visitor.VisitStock(*this); }
+
+const Ticker& Stock::GetTicker() const {
+  return TickerRegistry::Global().Resolve(ticker_);
+}
+
+TickerId Stock::GetTickerId() const { return ticker_; }
+
+uint32_t Stock::Quantity() const { return quantity_; }
+
+double Stock::Price() const { return price_; }
+
+absl::Status Stock::SetPrice(const double kPrice) {
+  if (auto status = CheckPrice(kPrice); !status.ok()) return status;
+  const double kOld = NetCost();
+  price_ = kPrice;
+  PropagateNetCostDelta(NetCost() - kOld);
+  return absl::OkStatus();
+}
+
+void Stock::SetQuantity(const uint32_t kQuantity) {
+  const double kOld = NetCost();
+  quantity_ = kQuantity;
+  PropagateNetCostDelta(NetCost() - kOld);
 }
 
 std::string Portfolio::ToString() const {
-  std::string result = "Portfolio:\n";
+  std::string result;
+  AppendTo(result);
+  return result;
+}
+
+void Portfolio::Accept(RiskVisitor& visitor) const {
+  WalkRiskTree(*this, visitor);
+}
+
+void Portfolio::AppendTo(std::string& out) const {
+  out += "Portfolio:\n";
   for (const auto& node : children_) {
-    result += node->ToString() + '\n';
+    node->AppendTo(out);
+    out += '\n';
   }
-  return result;
 }
 
-Stock::Stock(Ticker ticker, const uint32_t kQuantity, const double kPrice)
-    : ticker_(std::move(ticker)), quantity_(kQuantity), price_(kPrice) {}
+Stock::Stock(const TickerId ticker, const uint32_t kQuantity,
+             const double kPrice)
+    : ticker_(ticker), quantity_(kQuantity), price_(kPrice) {}
 
 absl::StatusOr<std::unique_ptr<Portfolio>> Portfolio::Create() {
   return std::make_unique<Portfolio>(Portfolio{});
 }
 
+absl::StatusOr<std::unique_ptr<Portfolio>> Portfolio::Create(
+    NodeArena& arena) {
+  auto* portfolio = new (arena) Portfolio();
+  portfolio->MarkInArena();
+  return std::unique_ptr<Portfolio>(portfolio);
+}
+
 absl::Status Portfolio::Add(std::unique_ptr<RiskNode> node) {
   if (!node) return absl::InvalidArgumentError("null child");
+  node->parent_ = this;
+  const double kCost = node->NetCost();
+  for (RiskNode* ancestor = this; ancestor != nullptr;
+       ancestor = ancestor->parent_) {
+    ancestor->subtree_size_ += node->subtree_size_;
+  }
   children_.emplace_back(std::move(node));
+  net_cost_ += kCost;
+  PropagateNetCostDelta(kCost);
   return absl::OkStatus();
 }
 
-double Portfolio::NetCost() const {
-  double sum = 0;
-  for (const auto& node : children_) {
-    sum += node->NetCost();
-  }
-  return sum;
-}
+double Portfolio::NetCost() const { return net_cost_; }
 
 const std::vector<std::unique_ptr<RiskNode>>& Portfolio::Children() const {
   return children_;
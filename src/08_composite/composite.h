@@ -5,8 +5,11 @@
 #ifndef GOF23_COMPOSITE_H
 #define GOF23_COMPOSITE_H
 
+#include <cstddef>
 #include <memory>
+#include <new>
 #include <string>
+#include <typeinfo>
 
 #include <absl/status/status.h>
 #include <absl/status/statusor.h>
@@ -25,11 +28,56 @@ struct Ticker {
   std::string name_;
 };
 
+// Index of a Ticker in a TickerRegistry (see ticker_registry.h).
+using TickerId = uint32_t;
+
+class NodeArena;
+class Portfolio;
+struct RiskVisitor;
+
+// Portfolios cache the NetCost of their subtree. A node whose NetCost
+// changes after it has been added reports the change through
+// PropagateNetCostDelta, which walks it up the parent chain, so an update
+// costs O(depth) and reading any total costs O(1). Totals are kept by
+// adding deltas, so they can drift from a fresh sum by rounding.
 struct RiskNode {
   virtual ~RiskNode() = default;
   [[nodiscard]] virtual double NetCost() const = 0;
   virtual absl::Status Add(std::unique_ptr<RiskNode>);
   [[nodiscard]] virtual std::string ToString() const = 0;
+
+  // Appends ToString() to out. Overridden to write in place, so a whole
+  // tree can be dumped into one buffer without a temporary per node.
+  virtual void AppendTo(std::string& out) const;
+
+  // Nodes in the subtree rooted here, this one included.
+  [[nodiscard]] std::size_t SubtreeSize() const { return subtree_size_; }
+
+  // Runs visitor over the subtree rooted here (see risk_visitor.h). Node
+  // types the visitor does not know reach it through VisitOther.
+  virtual void Accept(RiskVisitor& visitor) const;
+
+  // Heap nodes come from the global operator new and cost nothing extra.
+  // Arena nodes are marked by one bit, so a single unique_ptr<RiskNode>
+  // type owns both kinds: delete runs the destructor of either, and hands
+  // memory back only for heap nodes (see node_arena.h).
+  static void* operator new(std::size_t size) { return ::operator new(size); }
+  static void* operator new(std::size_t size, NodeArena& arena);
+  static void operator delete(RiskNode* node, std::destroying_delete_t);
+  static void operator delete(void* node, NodeArena& arena);
+
+ protected:
+  void PropagateNetCostDelta(
+      double kDelta) const;  // NOLINT(readability-identifier-naming)
+
+  // Called by the arena Create overloads on the node they placed.
+  void MarkInArena() { in_arena_ = true; }
+
+ private:
+  friend class Portfolio;
+  Portfolio* parent_ = nullptr;
+  std::size_t subtree_size_ : 63 = 1;
+  std::size_t in_arena_ : 1 = 0;  // top bit of the same word
 };
 
 class Stock final : public RiskNode {
@@ -39,16 +87,42 @@ class Stock final : public RiskNode {
       uint32_t kQuantity,  // NOLINT(readability-identifier-naming)
       double kPrice);      // NOLINT(readability-identifier-naming)
 
+  // As above, with the node placed in arena.
+  static absl::StatusOr<std::unique_ptr<Stock>> Create(
+      NodeArena& arena, Ticker ticker,
+      uint32_t kQuantity,  // NOLINT(readability-identifier-naming)
+      double kPrice);      // NOLINT(readability-identifier-naming)
+
   [[nodiscard]] double NetCost() const override;
 
   [[nodiscard]] std::string ToString() const override;
 
+  void AppendTo(std::string& out) const override;
+
+  void Accept(RiskVisitor& visitor) const override;
+
+  // Resolved from the global TickerRegistry, where Create interned it.
+  [[nodiscard]] const Ticker& GetTicker() const;
+
+  [[nodiscard]] TickerId GetTickerId() const;
+
+  [[nodiscard]] uint32_t Quantity() const;
+
+  [[nodiscard]] double Price() const;
+
+  // Both update the cached totals of every enclosing portfolio.
+  absl::Status SetPrice(
+      double kPrice);  // NOLINT(readability-identifier-naming)
+
+  void SetQuantity(
+      uint32_t kQuantity);  // NOLINT(readability-identifier-naming)
+
  private:
-  Stock(Ticker ticker,
+  Stock(TickerId ticker,
         uint32_t kQuantity,  // NOLINT(readability-identifier-naming)
         double kPrice);      // NOLINT(readability-identifier-naming)
 
-  Ticker ticker_;
+  TickerId ticker_;
   uint32_t quantity_;
   double price_;
 };
@@ -57,6 +131,9 @@ class Portfolio final : public RiskNode {
  public:
   static absl::StatusOr<std::unique_ptr<Portfolio>> Create();
 
+  // As above, with the node placed in arena.
+  static absl::StatusOr<std::unique_ptr<Portfolio>> Create(NodeArena& arena);
+
   absl::Status Add(std::unique_ptr<RiskNode> node) override;
 
   [[nodiscard]] double NetCost() const override;
@@ -65,10 +142,27 @@ class Portfolio final : public RiskNode {
 
   [[nodiscard]] std::string ToString() const override;
 
+  void AppendTo(std::string& out) const override;
+
+  // Walks the subtree iteratively, so depth costs no call stack.
+  void Accept(RiskVisitor& visitor) const override;
+
  private:
   explicit Portfolio();
 
+  friend struct RiskNode;
+
   std::vector<std::unique_ptr<RiskNode>> children_;
+  double net_cost_ = 0;  // cached sum of children_'s NetCost
 };
 
+// kNode as a Portfolio, or null if it is any other kind of node. Portfolio
+// is final, so an exact type check stands in for the much slower
+// dynamic_cast; the tree walkers call this once per node.
+inline const Portfolio* AsPortfolio(const RiskNode& kNode) {
+  return typeid(kNode) == typeid(Portfolio)
+             ? static_cast<const Portfolio*>(&kNode)
+             : nullptr;
+}
+
 #endif  // GOF23_COMPOSITE_H
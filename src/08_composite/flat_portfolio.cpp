@@ -0,0 +1,117 @@
+#include "flat_portfolio.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <absl/status/status.h>
+#include <absl/status/statusor.h>
+
+absl::StatusOr<FlatPortfolio> FlatPortfolio::Compile(const RiskNode& kTree) {
+  FlatPortfolio flat;
+
+  // Depth-first with an explicit stack so deep books cannot overflow the
+  // call stack. Children go on in reverse so they come off in order.
+  std::vector<std::pair<const RiskNode*, NodeId>> pending{{&kTree, kRoot}};
+  while (!pending.empty()) {
+    const auto [kNode, kParent] = pending.back();
+    pending.pop_back();
+    const auto kId = static_cast<NodeId>(flat.parent_.size());
+    const auto kLeaves = static_cast<uint32_t>(flat.quantity_.size());
+    flat.parent_.push_back(kParent);
+    flat.subtree_end_.push_back(kId + 1);
+    flat.leaf_begin_.push_back(kLeaves);
+
+    if (const auto* stock = dynamic_cast<const Stock*>(kNode)) {
+      flat.quantity_.push_back(static_cast<double>(stock->Quantity()));
+      flat.price_.push_back(stock->Price());
+      flat.leaf_end_.push_back(kLeaves + 1);
+      flat.is_leaf_.push_back(1);
+    } else if (const auto* portfolio = dynamic_cast<const Portfolio*>(kNode)) {
+      flat.leaf_end_.push_back(kLeaves);
+      flat.is_leaf_.push_back(0);
+      const auto& kChildren = portfolio->Children();
+      for (auto it = kChildren.rbegin(); it != kChildren.rend(); ++it) {
+        pending.emplace_back(it->get(), kId);
+      }
+    } else {
+      return absl::InvalidArgumentError("node type cannot be flattened");
+    }
+  }
+
+  // Children follow their parent in pre-order, so one backward pass closes
+  // every range before its parent reads it.
+  for (std::size_t id = flat.parent_.size() - 1; id > 0; --id) {
+    const NodeId kParent = flat.parent_[id];
+    flat.subtree_end_[kParent] =
+        std::max(flat.subtree_end_[kParent], flat.subtree_end_[id]);
+    flat.leaf_end_[kParent] =
+        std::max(flat.leaf_end_[kParent], flat.leaf_end_[id]);
+  }
+  return flat;
+}
+
+double FlatPortfolio::NetCost(const NodeId kNode) const {
+  const std::size_t kBegin = leaf_begin_[kNode];
+  const std::size_t kEnd = leaf_end_[kNode];
+  const double* const kQuantity = quantity_.data();
+  const double* const kPrice = price_.data();
+
+  // Four independent sums: without -ffast-math the compiler keeps one
+  // serial chain, and the add latency, not memory, would set the pace.
+  double sum[4] = {};
+  std::size_t i = kBegin;
+  for (; i + 4 <= kEnd; i += 4) {
+    for (std::size_t lane = 0; lane < 4; ++lane) {
+      sum[lane] += kQuantity[i + lane] * kPrice[i + lane];
+    }
+  }
+  for (; i < kEnd; ++i) sum[0] += kQuantity[i] * kPrice[i];
+  return (sum[0] + sum[1]) + (sum[2] + sum[3]);
+}
+
+std::vector<double> FlatPortfolio::SubtreeTotals() const {
+  std::vector<double> totals(NodeCount(), 0.0);
+
+  // Forward: price the leaves. A portfolio holding only stocks is closed out
+  // with the same multi-accumulator scan as NetCost, instead of having
+  // every leaf add into the one parent total in a serial chain.
+  for (std::size_t id = 0; id < NodeCount();) {
+    const uint32_t kLeaf = leaf_begin_[id];
+    if (is_leaf_[id] != 0) {
+      totals[id] = quantity_[kLeaf] * price_[kLeaf];
+      ++id;
+    } else if (HoldsOnlyLeaves(static_cast<NodeId>(id))) {
+      const std::size_t kCount = leaf_end_[id] - kLeaf;
+      for (std::size_t i = 0; i < kCount; ++i) {
+        totals[id + 1 + i] = quantity_[kLeaf + i] * price_[kLeaf + i];
+      }
+      totals[id] = NetCost(static_cast<NodeId>(id));
+      id = subtree_end_[id];
+    } else {
+      ++id;
+    }
+  }
+
+  // Backward: fold the remaining subtrees into their parents. Children come
+  // after their parent in pre-order, so each is complete before it is
+  // folded. Stocks under a portfolio closed out above are skipped by
+  // jumping straight to that portfolio.
+  for (std::size_t id = NodeCount() - 1; id > 0;) {
+    const NodeId kParent = parent_[id];
+    if (HoldsOnlyLeaves(kParent)) {
+      id = kParent;
+      continue;
+    }
+    totals[kParent] += totals[id];
+    --id;
+  }
+  return totals;
+}
+
+bool FlatPortfolio::HoldsOnlyLeaves(const NodeId kNode) const {
+  return is_leaf_[kNode] == 0 && subtree_end_[kNode] - kNode - 1 ==
+                                     leaf_end_[kNode] - leaf_begin_[kNode];
+}
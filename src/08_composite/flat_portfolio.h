@@ -0,0 +1,79 @@
+#ifndef GOF23_FLAT_PORTFOLIO_H
+#define GOF23_FLAT_PORTFOLIO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <absl/status/statusor.h>
+
+#include "composite.h"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+// A frozen copy of a RiskNode tree laid out for scans instead of pointer
+// chasing. Nodes are numbered in pre-order, so every subtree is the
+// contiguous node range [id, SubtreeEnd(id)) and the root is node 0. Stock
+// leaves keep their own structure-of-arrays quantity and price columns in
+// the same order, so the leaves under any node are one contiguous run too.
+//
+// Compiling copies the numbers, so later changes to the source tree are
+// not seen; recompile to pick them up.
+class FlatPortfolio {
+ public:
+  using NodeId = uint32_t;
+  static constexpr NodeId kRoot = 0;
+
+  // Fails on node types it does not know how to flatten.
+  static absl::StatusOr<FlatPortfolio> Compile(const RiskNode& kTree);
+
+  [[nodiscard]] double NetCost() const { return NetCost(kRoot); }
+
+  // Sum of quantity x price over the leaves under kNode.
+  [[nodiscard]] double NetCost(NodeId kNode) const;
+
+  // NetCost of every node at once, indexed by NodeId: all-stock portfolios
+  // are scanned like NetCost, then a backward pass folds the rest into
+  // their parents.
+  [[nodiscard]] std::vector<double> SubtreeTotals() const;
+
+  [[nodiscard]] std::size_t NodeCount() const { return parent_.size(); }
+  [[nodiscard]] std::size_t LeafCount() const { return quantity_.size(); }
+
+  // kRoot is its own parent.
+  [[nodiscard]] NodeId Parent(NodeId kNode) const { return parent_[kNode]; }
+  [[nodiscard]] NodeId SubtreeEnd(NodeId kNode) const {
+    return subtree_end_[kNode];
+  }
+  [[nodiscard]] bool IsLeaf(NodeId kNode) const {
+    return is_leaf_[kNode] != 0;
+  }
+
+  [[nodiscard]] std::span<const double> Quantities() const {
+    return quantity_;
+  }
+  [[nodiscard]] std::span<const double> Prices() const { return price_; }
+
+ private:
+  FlatPortfolio() = default;
+
+  // A portfolio whose children are all stocks, or that has none.
+  [[nodiscard]] bool HoldsOnlyLeaves(NodeId kNode) const;
+
+  // Per node, indexed by NodeId.
+  std::vector<NodeId> parent_;
+  std::vector<NodeId> subtree_end_;
+  std::vector<uint32_t> leaf_begin_;
+  std::vector<uint32_t> leaf_end_;
+  std::vector<uint8_t> is_leaf_;  // 1 for Stock nodes
+
+  // Per leaf, in pre-order. Quantities are widened to double once here
+  // rather than on every scan.
+  std::vector<double> quantity_;
+  std::vector<double> price_;
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_FLAT_PORTFOLIO_H
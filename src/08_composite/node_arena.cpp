@@ -0,0 +1,18 @@
+#include "node_arena.h"
+
+#include <cassert>
+#include <cstddef>
+#include <memory_resource>
+
+NodeArena::NodeArena(const std::size_t initial_bytes)
+    : resource_(initial_bytes, std::pmr::new_delete_resource()) {}
+
+NodeArena::~NodeArena() {
+  assert(live_nodes_ == 0 && "a node outlived its NodeArena");
+}
+
+void* NodeArena::Allocate(const std::size_t kBytes,
+                          const std::size_t kAlignment) {
+  bytes_ += kBytes;
+  return resource_.allocate(kBytes, kAlignment);
+}
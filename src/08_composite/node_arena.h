@@ -0,0 +1,48 @@
+#ifndef GOF23_NODE_ARENA_H
+#define GOF23_NODE_ARENA_H
+
+#include <cstddef>
+#include <memory_resource>
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+// Monotonic memory for the RiskNodes of one book. Stock::Create and
+// Portfolio::Create have overloads that place the node here instead of on
+// the heap; the node is still owned by an ordinary unique_ptr<RiskNode> and
+// deleting it runs its destructor, but its memory is only given back, all
+// at once, when the arena goes.
+//
+// Only the nodes themselves live here. A Portfolio's children_ vector is
+// still on the heap, and the node's destructor frees it as usual. A Stock
+// holds just a TickerId; the text behind it belongs to the global
+// TickerRegistry for the life of the process.
+//
+// The arena must outlive every node placed in it. Debug builds count the
+// live ones and assert in the destructor that none are left; release
+// builds do not check. Not thread safe.
+class NodeArena {
+ public:
+  explicit NodeArena(std::size_t initial_bytes = std::size_t{1} << 20);
+  ~NodeArena();
+
+  NodeArena(const NodeArena&) = delete;
+  NodeArena& operator=(const NodeArena&) = delete;
+
+  [[nodiscard]] void* Allocate(std::size_t kBytes, std::size_t kAlignment);
+
+  // Bytes handed out so far, debug headers included.
+  [[nodiscard]] std::size_t BytesAllocated() const { return bytes_; }
+
+  // Kept by RiskNode's arena operator new and delete in debug builds.
+  void NodeCreated() { ++live_nodes_; }
+  void NodeDestroyed() { --live_nodes_; }
+
+ private:
+  std::pmr::monotonic_buffer_resource resource_;
+  std::size_t bytes_ = 0;
+  std::size_t live_nodes_ = 0;
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_NODE_ARENA_H
@@ -0,0 +1,37 @@
+#include "parallel_rollup.h"
+
+#include <cstddef>
+#include <vector>
+
+ParallelRollup::ParallelRollup() : ParallelRollup(Options{}) {}
+
+ParallelRollup::ParallelRollup(const Options options)
+    : options_(options), pool_(options.threads_) {}
+
+std::vector<ParallelRollup::Step> ParallelRollup::Split(
+    const RiskNode& kRoot) const {
+  std::vector<Step> steps;
+  std::vector<const RiskNode*> pending{&kRoot};
+  while (!pending.empty()) {
+    const RiskNode* node = pending.back();
+    pending.pop_back();
+    const Portfolio* portfolio = AsPortfolio(*node);
+    if (portfolio == nullptr || node->SubtreeSize() <= options_.threshold_) {
+      steps.push_back({.node_ = node, .split_ = false, .children_ = 0});
+      continue;
+    }
+    const auto& kChildren = portfolio->Children();
+    steps.push_back(
+        {.node_ = node, .split_ = true, .children_ = kChildren.size()});
+    for (auto it = kChildren.rbegin(); it != kChildren.rend(); ++it) {
+      pending.push_back(it->get());
+    }
+  }
+  return steps;
+}
+
+double ParallelRollup::NetCost(const RiskNode& kRoot) {
+  return Fold(
+      kRoot, 0.0, [](const RiskNode& kLeaf) { return kLeaf.NetCost(); },
+      [](const double kSum, const double kCost) { return kSum + kCost; });
+}
@@ -0,0 +1,131 @@
+#ifndef GOF23_PARALLEL_ROLLUP_H
+#define GOF23_PARALLEL_ROLLUP_H
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "../helpers/WorkStealingPool.h"
+#include "composite.h"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+// Folds a value over every leaf of a RiskNode tree on a WorkStealingPool.
+// Portfolios bigger than threshold_ nodes are split into their children;
+// whatever is left at or below it becomes one task, folded serially. The
+// pool spreads the tasks, stealing so that lopsided subtrees still balance,
+// and the split portfolios are then combined on the calling thread.
+//
+// combine must be associative. Results are combined left to right in child
+// order and the split depends only on the tree, so a fold gives the same
+// answer on every run and thread count, though floating-point sums may
+// round differently from a serial walk.
+//
+// One Fold at a time per rollup, and the tree must not change during it.
+class ParallelRollup {
+ public:
+  struct Options {
+    std::size_t threshold_ = std::size_t{1} << 14;  // nodes per serial task
+    unsigned threads_ = 0;  // 0: one per hardware thread
+  };
+
+  ParallelRollup();
+  explicit ParallelRollup(Options options);
+
+  // leaf(const RiskNode&) -> T is called for every node that is not a
+  // Portfolio; empty portfolios contribute kIdentity.
+  template <class T, class Leaf, class Combine>
+  T Fold(const RiskNode& kRoot, T kIdentity, Leaf leaf, Combine combine);
+
+  // NetCost re-summed from the leaves rather than read from the cached
+  // totals, e.g. for an end-of-day check on their drift.
+  double NetCost(const RiskNode& kRoot);
+
+  [[nodiscard]] unsigned ThreadCount() const { return pool_.Size(); }
+
+ private:
+  // The split, in pre-order: a split portfolio and how many of its
+  // children follow, or a subtree small enough to be one task.
+  struct Step {
+    const RiskNode* node_;
+    bool split_;
+    std::size_t children_;
+  };
+  [[nodiscard]] std::vector<Step> Split(const RiskNode& kRoot) const;
+
+  template <class T, class Leaf, class Combine>
+  static T FoldSerial(const RiskNode& kRoot, T kIdentity, Leaf& leaf,
+                      Combine& combine);
+
+  Options options_;
+  WorkStealingPool pool_;
+};
+
+template <class T, class Leaf, class Combine>
+T ParallelRollup::FoldSerial(const RiskNode& kRoot, T kIdentity, Leaf& leaf,
+                             Combine& combine) {
+  T result = std::move(kIdentity);
+  std::vector<const RiskNode*> pending{&kRoot};
+  while (!pending.empty()) {
+    const RiskNode* node = pending.back();
+    pending.pop_back();
+    if (const Portfolio* portfolio = AsPortfolio(*node)) {
+      const auto& kChildren = portfolio->Children();
+      for (auto it = kChildren.rbegin(); it != kChildren.rend(); ++it) {
+        pending.push_back(it->get());
+      }
+    } else {
+      result = combine(std::move(result), leaf(*node));
+    }
+  }
+  return result;
+}
+
+template <class T, class Leaf, class Combine>
+T ParallelRollup::Fold(const RiskNode& kRoot, T kIdentity, Leaf leaf,
+                       Combine combine) {
+  if (pool_.Size() == 1 || kRoot.SubtreeSize() <= options_.threshold_) {
+    return FoldSerial(kRoot, std::move(kIdentity), leaf, combine);
+  }
+
+  const std::vector<Step> kSteps = Split(kRoot);
+  std::vector<const RiskNode*> tasks;
+  for (const Step& kStep : kSteps) {
+    if (!kStep.split_) tasks.push_back(kStep.node_);
+  }
+  // Wrapped so that T = bool does not get std::vector<bool>'s shared words.
+  struct Result {
+    T value_;
+  };
+  std::vector<Result> results(tasks.size(), Result{kIdentity});
+  pool_.ParallelFor(tasks.size(), 1,
+                    [&](unsigned /*participant*/, const std::size_t kBegin,
+                        const std::size_t kEnd) {
+                      for (std::size_t t = kBegin; t < kEnd; ++t) {
+                        results[t].value_ =
+                            FoldSerial(*tasks[t], kIdentity, leaf, combine);
+                      }
+                    });
+
+  // Walk the split backwards: a step's children are complete on the stack
+  // by the time it is reached, with its first child on top.
+  std::vector<T> stack;
+  std::size_t task = tasks.size();
+  for (auto it = kSteps.rbegin(); it != kSteps.rend(); ++it) {
+    if (!it->split_) {
+      stack.push_back(std::move(results[--task].value_));
+      continue;
+    }
+    T value = kIdentity;
+    for (std::size_t c = 0; c < it->children_; ++c) {
+      value = combine(std::move(value), std::move(stack.back()));
+      stack.pop_back();
+    }
+    stack.push_back(std::move(value));
+  }
+  return std::move(stack.back());
+}
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_PARALLEL_ROLLUP_H
@@ -0,0 +1,325 @@
+#include "portfolio_snapshot.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/status/status.h>
+#include <absl/status/statusor.h>
+#include <absl/strings/string_view.h>
+
+namespace {
+
+constexpr char kMagic[8] = {'G', 'O', 'F', '2', '3', 'S', 'N', 'P'};
+constexpr uint32_t kVersion = 1;
+constexpr uint32_t kByteOrder = 0x01020304;
+constexpr uint32_t kNoTicker = std::numeric_limits<uint32_t>::max();
+
+}  // namespace
+
+struct PortfolioSnapshot::Header {
+  char magic_[8];
+  uint32_t version_;
+  uint32_t byte_order_;
+  uint32_t ticker_count_;
+  uint32_t node_count_;
+  uint64_t pool_bytes_;
+};
+
+struct PortfolioSnapshot::TickerRecord {
+  uint32_t symbol_offset_;
+  uint32_t symbol_length_;
+  uint32_t name_offset_;
+  uint32_t name_length_;
+};
+
+// Portfolios have no ticker and a zero quantity and price, so NetCost can
+// sum every record without looking at its kind.
+struct PortfolioSnapshot::NodeRecord {
+  double price_;
+  uint32_t quantity_;
+  uint32_t ticker_;  // kNoTicker for portfolios
+  uint32_t first_child_;
+  uint32_t child_count_;
+};
+
+absl::Status PortfolioSnapshot::Write(const RiskNode& kRoot,
+                                      std::ostream& sink) {
+  std::vector<NodeRecord> nodes;
+  std::vector<TickerRecord> tickers;
+  std::string pool;
+  // Stocks already share interned tickers, so the registry id is enough to
+  // spot repeats.
+  absl::flat_hash_map<TickerId, uint32_t> ticker_index;
+  const auto kIntern = [&](const Stock& kStock) {
+    const auto [kIt, kInserted] = ticker_index.try_emplace(
+        kStock.GetTickerId(), static_cast<uint32_t>(tickers.size()));
+    if (kInserted) {
+      const Ticker& kTicker = kStock.GetTicker();
+      tickers.push_back({.symbol_offset_ = static_cast<uint32_t>(pool.size()),
+                         .symbol_length_ =
+                             static_cast<uint32_t>(kTicker.Symbol().size()),
+                         .name_offset_ = static_cast<uint32_t>(
+                             pool.size() + kTicker.Symbol().size()),
+                         .name_length_ =
+                             static_cast<uint32_t>(kTicker.Name().size())});
+      pool += kTicker.Symbol();
+      pool += kTicker.Name();
+    }
+    return kIt->second;
+  };
+
+  // Breadth-first, so each portfolio's children are numbered together.
+  std::vector<const RiskNode*> order{&kRoot};
+  for (std::size_t id = 0; id < order.size(); ++id) {
+    const RiskNode* node = order[id];
+    if (const auto* stock = dynamic_cast<const Stock*>(node)) {
+      nodes.push_back({.price_ = stock->Price(),
+                       .quantity_ = stock->Quantity(),
+                       .ticker_ = kIntern(*stock),
+                       .first_child_ = 0,
+                       .child_count_ = 0});
+    } else if (const auto* portfolio = dynamic_cast<const Portfolio*>(node)) {
+      const auto& kChildren = portfolio->Children();
+      nodes.push_back(
+          {.price_ = 0,
+           .quantity_ = 0,
+           .ticker_ = kNoTicker,
+           .first_child_ = static_cast<uint32_t>(order.size()),
+           .child_count_ = static_cast<uint32_t>(kChildren.size())});
+      for (const auto& child : kChildren) order.push_back(child.get());
+    } else {
+      return absl::InvalidArgumentError("node type cannot be stored");
+    }
+    if (order.size() >= kNoTicker || pool.size() >= kNoTicker) {
+      return absl::OutOfRangeError("tree is too large for a snapshot");
+    }
+  }
+
+  Header header{};
+  std::memcpy(header.magic_, kMagic, sizeof(kMagic));
+  header.version_ = kVersion;
+  header.byte_order_ = kByteOrder;
+  header.ticker_count_ = static_cast<uint32_t>(tickers.size());
+  header.node_count_ = static_cast<uint32_t>(nodes.size());
+  header.pool_bytes_ = pool.size();
+
+  sink.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  sink.write(reinterpret_cast<const char*>(tickers.data()),
+             static_cast<std::streamsize>(tickers.size() *
+                                          sizeof(TickerRecord)));
+  sink.write(reinterpret_cast<const char*>(nodes.data()),
+             static_cast<std::streamsize>(nodes.size() * sizeof(NodeRecord)));
+  sink.write(pool.data(), static_cast<std::streamsize>(pool.size()));
+  if (!sink) return absl::DataLossError("write to sink failed");
+  return absl::OkStatus();
+}
+
+absl::StatusOr<std::unique_ptr<PortfolioSnapshot>> PortfolioSnapshot::Open(
+    const std::string& kPath) {
+  const int kFd = ::open(kPath.c_str(), O_RDONLY | O_CLOEXEC);
+  if (kFd < 0) return absl::ErrnoToStatus(errno, "cannot open snapshot");
+  struct stat info {};
+  if (::fstat(kFd, &info) != 0) {
+    const int kError = errno;
+    ::close(kFd);
+    return absl::ErrnoToStatus(kError, "cannot stat snapshot");
+  }
+  const auto kSize = static_cast<std::size_t>(info.st_size);
+  if (kSize < sizeof(Header)) {
+    ::close(kFd);
+    return absl::DataLossError("snapshot is truncated");
+  }
+  void* const kMapping = ::mmap(nullptr, kSize, PROT_READ, MAP_PRIVATE, kFd, 0);
+  const int kError = errno;
+  ::close(kFd);  // the mapping keeps the file open
+  if (kMapping == MAP_FAILED) {
+    return absl::ErrnoToStatus(kError, "cannot map snapshot");
+  }
+
+  std::unique_ptr<PortfolioSnapshot> snapshot(
+      new PortfolioSnapshot(static_cast<const std::byte*>(kMapping), kSize));
+  if (auto status = snapshot->Index(); !status.ok()) return status;
+  return snapshot;
+}
+
+PortfolioSnapshot::PortfolioSnapshot(const std::byte* mapping,
+                                     const std::size_t size)
+    : mapping_(mapping), size_(size) {}
+
+PortfolioSnapshot::~PortfolioSnapshot() {
+  ::munmap(const_cast<std::byte*>(mapping_), size_);
+}
+
+absl::Status PortfolioSnapshot::Index() {
+  // The records are read in place, so their layout is the file format.
+  static_assert(sizeof(Header) == 32);
+  static_assert(sizeof(TickerRecord) == 16);
+  static_assert(sizeof(NodeRecord) == 24);
+  static_assert(std::is_trivially_copyable_v<NodeRecord>);
+
+  Header header{};
+  std::memcpy(&header, mapping_, sizeof(header));
+  if (std::memcmp(header.magic_, kMagic, sizeof(kMagic)) != 0) {
+    return absl::DataLossError("not a portfolio snapshot");
+  }
+  if (header.byte_order_ != kByteOrder) {
+    return absl::FailedPreconditionError(
+        "snapshot was written with another byte order");
+  }
+  if (header.version_ != kVersion) {
+    return absl::FailedPreconditionError("unsupported snapshot version");
+  }
+  const uint64_t kExpected =
+      sizeof(Header) + (uint64_t{header.ticker_count_} * sizeof(TickerRecord)) +
+      (uint64_t{header.node_count_} * sizeof(NodeRecord)) + header.pool_bytes_;
+  if (header.node_count_ == 0 || header.pool_bytes_ > size_ ||
+      kExpected != size_) {
+    return absl::DataLossError("snapshot sections do not match its size");
+  }
+
+  ticker_count_ = header.ticker_count_;
+  node_count_ = header.node_count_;
+  pool_bytes_ = header.pool_bytes_;
+  // Every section starts 8-byte aligned in a page-aligned mapping.
+  tickers_ = reinterpret_cast<const TickerRecord*>(mapping_ + sizeof(Header));
+  nodes_ = reinterpret_cast<const NodeRecord*>(tickers_ + ticker_count_);
+  pool_ = reinterpret_cast<const char*>(nodes_ + node_count_);
+
+  for (std::size_t t = 0; t < ticker_count_; ++t) {
+    const TickerRecord& kTicker = tickers_[t];
+    if (uint64_t{kTicker.symbol_offset_} + kTicker.symbol_length_ >
+            pool_bytes_ ||
+        uint64_t{kTicker.name_offset_} + kTicker.name_length_ > pool_bytes_) {
+      return absl::DataLossError("ticker points outside the string pool");
+    }
+  }
+
+  // In breadth-first order every node but the root has been claimed as a
+  // child by an earlier portfolio before it is reached, and the ranges are
+  // handed out back to back; that makes them one tree with no cycles.
+  uint64_t claimed = 1;
+  for (std::size_t id = 0; id < node_count_; ++id) {
+    const NodeRecord& kNode = nodes_[id];
+    if (id >= claimed) {
+      return absl::DataLossError("snapshot node has no parent");
+    }
+    if (kNode.ticker_ == kNoTicker) {
+      if (kNode.first_child_ != claimed || kNode.quantity_ != 0 ||
+          kNode.price_ != 0) {
+        return absl::DataLossError("snapshot portfolio is malformed");
+      }
+      claimed += kNode.child_count_;
+    } else if (kNode.ticker_ >= ticker_count_ || kNode.child_count_ != 0) {
+      return absl::DataLossError("snapshot stock is malformed");
+    }
+  }
+  if (claimed != node_count_) {
+    return absl::DataLossError("snapshot child ranges do not cover its nodes");
+  }
+  return absl::OkStatus();
+}
+
+const PortfolioSnapshot::NodeRecord& PortfolioSnapshot::Node(
+    const NodeId kNode) const {
+  return nodes_[kNode];
+}
+
+absl::string_view PortfolioSnapshot::Pooled(const uint32_t kOffset,
+                                            const uint32_t kLength) const {
+  return {pool_ + kOffset, kLength};
+}
+
+bool PortfolioSnapshot::IsPortfolio(const NodeId kNode) const {
+  return Node(kNode).ticker_ == kNoTicker;
+}
+
+PortfolioSnapshot::NodeId PortfolioSnapshot::FirstChild(
+    const NodeId kNode) const {
+  return Node(kNode).first_child_;
+}
+
+uint32_t PortfolioSnapshot::ChildCount(const NodeId kNode) const {
+  return Node(kNode).child_count_;
+}
+
+absl::string_view PortfolioSnapshot::Symbol(const NodeId kNode) const {
+  if (IsPortfolio(kNode)) return {};
+  const TickerRecord& kTicker = tickers_[Node(kNode).ticker_];
+  return Pooled(kTicker.symbol_offset_, kTicker.symbol_length_);
+}
+
+absl::string_view PortfolioSnapshot::Name(const NodeId kNode) const {
+  if (IsPortfolio(kNode)) return {};
+  const TickerRecord& kTicker = tickers_[Node(kNode).ticker_];
+  return Pooled(kTicker.name_offset_, kTicker.name_length_);
+}
+
+uint32_t PortfolioSnapshot::Quantity(const NodeId kNode) const {
+  return Node(kNode).quantity_;
+}
+
+double PortfolioSnapshot::Price(const NodeId kNode) const {
+  return Node(kNode).price_;
+}
+
+double PortfolioSnapshot::NetCost() const {
+  const auto kValue = [this](const std::size_t kId) {
+    return nodes_[kId].quantity_ * nodes_[kId].price_;
+  };
+  double sum[4] = {};
+  std::size_t id = 0;
+  for (; id + 4 <= node_count_; id += 4) {
+    for (std::size_t lane = 0; lane < 4; ++lane) sum[lane] += kValue(id + lane);
+  }
+  for (; id < node_count_; ++id) sum[0] += kValue(id);
+  return (sum[0] + sum[1]) + (sum[2] + sum[3]);
+}
+
+absl::StatusOr<std::unique_ptr<RiskNode>> PortfolioSnapshot::Materialize(
+    NodeArena* arena) const {
+  // Built from the back, so every child exists before its portfolio, and
+  // each portfolio is filled before it gets a parent: Add then has no
+  // ancestors to update.
+  std::vector<std::unique_ptr<RiskNode>> built(node_count_);
+  for (std::size_t id = node_count_; id-- > 0;) {
+    const auto kId = static_cast<NodeId>(id);
+    if (IsPortfolio(kId)) {
+      auto portfolio_or = arena != nullptr ? Portfolio::Create(*arena)
+                                           : Portfolio::Create();
+      if (!portfolio_or.ok()) return portfolio_or.status();
+      std::unique_ptr<RiskNode> portfolio = std::move(portfolio_or).value();
+      const NodeId kFirst = FirstChild(kId);
+      for (NodeId c = kFirst; c < kFirst + ChildCount(kId); ++c) {
+        if (auto status = portfolio->Add(std::move(built[c])); !status.ok()) {
+          return status;
+        }
+      }
+      built[id] = std::move(portfolio);
+    } else {
+      Ticker ticker{std::string(Symbol(kId)), std::string(Name(kId))};
+      auto stock_or =
+          arena != nullptr
+              ? Stock::Create(*arena, std::move(ticker), Quantity(kId),
+                              Price(kId))
+              : Stock::Create(std::move(ticker), Quantity(kId), Price(kId));
+      if (!stock_or.ok()) return stock_or.status();
+      built[id] = std::move(stock_or).value();
+    }
+  }
+  return std::move(built.front());
+}
@@ -0,0 +1,101 @@
+#ifndef GOF23_PORTFOLIO_SNAPSHOT_H
+#define GOF23_PORTFOLIO_SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+
+#include <absl/status/status.h>
+#include <absl/status/statusor.h>
+#include <absl/strings/string_view.h>
+
+#include "composite.h"
+#include "node_arena.h"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+// A RiskNode tree saved as one flat binary image that is read back by
+// mapping the file, not by parsing it. The image is four sections, each
+// 8-byte aligned, in the host's byte order:
+//
+//   Header    magic, version, byte-order mark and section sizes
+//   tickers   one record per distinct (symbol, name) pair: offsets into
+//             the string pool, so a ticker shared by many stocks is stored
+//             once
+//   nodes     one fixed-size record per node in breadth-first order, so the
+//             children of a portfolio are the contiguous range
+//             [FirstChild, FirstChild + ChildCount); node 0 is the root
+//   pool      the ticker strings, back to back
+//
+// Open checks the header and bounds-checks every record once, then serves
+// reads straight from the mapping. Nothing is copied until Materialize is
+// asked for a live tree.
+class PortfolioSnapshot {
+ public:
+  using NodeId = uint32_t;
+  static constexpr NodeId kRoot = 0;
+
+  // Writes the image of kRoot to sink. Fails on node types it does not know
+  // how to store.
+  static absl::Status Write(const RiskNode& kRoot, std::ostream& sink);
+
+  // Maps the image at kPath read-only. A file that is not an image, or is
+  // truncated or inconsistent, is DataLoss; one from another version or
+  // byte order is FailedPrecondition.
+  static absl::StatusOr<std::unique_ptr<PortfolioSnapshot>> Open(
+      const std::string& kPath);
+
+  ~PortfolioSnapshot();
+  PortfolioSnapshot(const PortfolioSnapshot&) = delete;
+  PortfolioSnapshot& operator=(const PortfolioSnapshot&) = delete;
+
+  [[nodiscard]] std::size_t NodeCount() const { return node_count_; }
+  [[nodiscard]] std::size_t TickerCount() const { return ticker_count_; }
+
+  [[nodiscard]] bool IsPortfolio(NodeId kNode) const;
+  [[nodiscard]] NodeId FirstChild(NodeId kNode) const;
+  [[nodiscard]] uint32_t ChildCount(NodeId kNode) const;
+
+  // Empty or zero for portfolios; the views point into the mapping.
+  [[nodiscard]] absl::string_view Symbol(NodeId kNode) const;
+  [[nodiscard]] absl::string_view Name(NodeId kNode) const;
+  [[nodiscard]] uint32_t Quantity(NodeId kNode) const;
+  [[nodiscard]] double Price(NodeId kNode) const;
+
+  // Sum of quantity x price over every stock in the image.
+  [[nodiscard]] double NetCost() const;
+
+  // Rebuilds the live tree, in arena when one is given.
+  [[nodiscard]] absl::StatusOr<std::unique_ptr<RiskNode>> Materialize(
+      NodeArena* arena = nullptr) const;
+
+ private:
+  struct Header;
+  struct TickerRecord;
+  struct NodeRecord;
+
+  PortfolioSnapshot(const std::byte* mapping, std::size_t size);
+
+  // Reads the header, points the sections into the mapping and checks that
+  // every offset stays inside it and the child ranges form one tree.
+  absl::Status Index();
+
+  [[nodiscard]] const NodeRecord& Node(NodeId kNode) const;
+  [[nodiscard]] absl::string_view Pooled(uint32_t kOffset,
+                                         uint32_t kLength) const;
+
+  const std::byte* mapping_;
+  std::size_t size_;
+  const TickerRecord* tickers_ = nullptr;
+  const NodeRecord* nodes_ = nullptr;
+  const char* pool_ = nullptr;
+  std::size_t ticker_count_ = 0;
+  std::size_t node_count_ = 0;
+  std::size_t pool_bytes_ = 0;
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_PORTFOLIO_SNAPSHOT_H
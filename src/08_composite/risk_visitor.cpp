@@ -0,0 +1,68 @@
+#include "risk_visitor.h"
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+void WalkRiskTree(const RiskNode& kRoot, RiskVisitor& visitor) {
+  // A portfolio goes back on the stack as a leave marker under its
+  // children, which are pushed in reverse so they come off in order.
+  struct Pending {
+    const RiskNode* node_;
+    bool leave_;
+  };
+  std::vector<Pending> pending{{&kRoot, false}};
+  while (!pending.empty()) {
+    const Pending kTop = pending.back();
+    pending.pop_back();
+    const Portfolio* portfolio = AsPortfolio(*kTop.node_);
+    if (portfolio == nullptr) {
+      kTop.node_->Accept(visitor);
+      continue;
+    }
+    const Portfolio& kPortfolio = *portfolio;
+    if (kTop.leave_) {
+      visitor.LeavePortfolio(kPortfolio);
+      continue;
+    }
+    visitor.EnterPortfolio(kPortfolio);
+    pending.push_back({&kPortfolio, true});
+    const auto& kChildren = kPortfolio.Children();
+    for (auto it = kChildren.rbegin(); it != kChildren.rend(); ++it) {
+      pending.push_back({it->get(), false});
+    }
+  }
+}
+
+VisitorGroup::VisitorGroup(std::vector<RiskVisitor*> members)
+    : members_(std::move(members)) {}
+
+void VisitorGroup::VisitStock(const Stock& kStock) {
+  for (RiskVisitor* member : members_) member->VisitStock(kStock);
+}
+
+void VisitorGroup::EnterPortfolio(const Portfolio& kPortfolio) {
+  for (RiskVisitor* member : members_) member->EnterPortfolio(kPortfolio);
+}
+
+void VisitorGroup::LeavePortfolio(const Portfolio& kPortfolio) {
+  for (RiskVisitor* member : members_) member->LeavePortfolio(kPortfolio);
+}
+
+void VisitorGroup::VisitOther(const RiskNode& kNode) {
+  for (RiskVisitor* member : members_) member->VisitOther(kNode);
+}
+
+void NetCostVisitor::VisitStock(const Stock& kStock) {
+  total_ += kStock.Quantity() * kStock.Price();
+}
+
+void GrossExposureVisitor::VisitStock(const Stock& kStock) {
+  total_ += kStock.Quantity() * std::fabs(kStock.Price());
+}
+
+void PositionCountVisitor::VisitStock(const Stock& /*stock*/) { ++count_; }
+
+void SymbolTotalsVisitor::VisitStock(const Stock& kStock) {
+  totals_[kStock.GetTicker().Symbol()] += kStock.Quantity() * kStock.Price();
+}
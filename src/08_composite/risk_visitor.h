@@ -0,0 +1,101 @@
+#ifndef GOF23_RISK_VISITOR_H
+#define GOF23_RISK_VISITOR_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+
+#include "composite.h"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+// Visitor over a RiskNode tree: an operation on the book written once per
+// node type, outside the node classes. Each hook defaults to doing
+// nothing, so a visitor overrides only the ones it needs.
+//
+// Run one with RiskNode::Accept or WalkRiskTree. Several aggregations can
+// share a single walk through VisitorGroup instead of each walking the
+// tree on its own.
+struct RiskVisitor {
+  virtual ~RiskVisitor() = default;
+
+  virtual void VisitStock(const Stock& /*stock*/) {}
+
+  // Called before a portfolio's children are visited, and after.
+  virtual void EnterPortfolio(const Portfolio& /*portfolio*/) {}
+  virtual void LeavePortfolio(const Portfolio& /*portfolio*/) {}
+
+  // Nodes of any other type.
+  virtual void VisitOther(const RiskNode& /*node*/) {}
+};
+
+// Visits kRoot's subtree depth-first, children in order, with an explicit
+// stack so a deep book cannot overflow the call stack. Nodes other than
+// portfolios are dispatched through their Accept.
+void WalkRiskTree(const RiskNode& kRoot, RiskVisitor& visitor);
+
+// Fans every hook out to each member in turn, so one walk feeds them all.
+class VisitorGroup final : public RiskVisitor {
+ public:
+  explicit VisitorGroup(std::vector<RiskVisitor*> members);
+
+  void VisitStock(const Stock& kStock) override;
+  void EnterPortfolio(const Portfolio& kPortfolio) override;
+  void LeavePortfolio(const Portfolio& kPortfolio) override;
+  void VisitOther(const RiskNode& kNode) override;
+
+ private:
+  std::vector<RiskVisitor*> members_;
+};
+
+// Sum of quantity x price, re-summed from the leaves.
+class NetCostVisitor final : public RiskVisitor {
+ public:
+  void VisitStock(const Stock& kStock) override;
+  [[nodiscard]] double Total() const { return total_; }
+
+ private:
+  double total_ = 0;
+};
+
+// Sum of |quantity| x |price|. Quantities are unsigned, so this agrees
+// with NetCostVisitor on any book whose prices are all non-negative; only
+// negative prices (spreads, some futures) set the two apart, and they will
+// diverge generally once positions can be short.
+class GrossExposureVisitor final : public RiskVisitor {
+ public:
+  void VisitStock(const Stock& kStock) override;
+  [[nodiscard]] double Total() const { return total_; }
+
+ private:
+  double total_ = 0;
+};
+
+// Number of stock positions.
+class PositionCountVisitor final : public RiskVisitor {
+ public:
+  void VisitStock(const Stock& kStock) override;
+  [[nodiscard]] std::size_t Count() const { return count_; }
+
+ private:
+  std::size_t count_ = 0;
+};
+
+// quantity x price summed per symbol.
+class SymbolTotalsVisitor final : public RiskVisitor {
+ public:
+  void VisitStock(const Stock& kStock) override;
+  [[nodiscard]] const absl::flat_hash_map<std::string, double>& Totals()
+      const {
+    return totals_;
+  }
+
+ private:
+  absl::flat_hash_map<std::string, double> totals_;
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_RISK_VISITOR_H
@@ -0,0 +1,114 @@
+#include "scenario_engine.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <absl/status/status.h>
+#include <absl/status/statusor.h>
+#include <absl/strings/string_view.h>
+
+#include "../helpers/SimdLanes.h"
+
+namespace {
+
+// Scenarios evaluated together. Each exposure vector is loaded once per
+// block, and the rows give the FMA chains independent accumulators.
+constexpr std::size_t kBlock = 4;
+
+// out[r] for the kRows scenarios whose shocks start at kShocks. Each row is
+// summed the same way whatever kRows is, so a scenario's result does not
+// depend on which block it landed in.
+template <class V, std::size_t kRows>
+void EvaluateRows(const std::span<const double> kExposure,
+                  const double* const kShocks, const double kBase,
+                  double* const out) {
+  using Reg = typename V::Reg;
+  const std::size_t kColumns = kExposure.size();
+  const std::size_t kVectorEnd = kColumns - (kColumns % V::kWidth);
+
+  Reg sum[kRows];
+  for (std::size_t r = 0; r < kRows; ++r) sum[r] = V::Set1(0.0);
+  for (std::size_t k = 0; k < kVectorEnd; k += V::kWidth) {
+    const Reg kExposureLanes = V::Load(kExposure.data() + k);
+    for (std::size_t r = 0; r < kRows; ++r) {
+      sum[r] =
+          V::Fma(kExposureLanes, V::Load(kShocks + (r * kColumns) + k), sum[r]);
+    }
+  }
+  for (std::size_t r = 0; r < kRows; ++r) {
+    double total = V::ReduceAdd(sum[r]);
+    for (std::size_t k = kVectorEnd; k < kColumns; ++k) {
+      total += kExposure[k] * kShocks[(r * kColumns) + k];
+    }
+    out[r] = kBase + total;
+  }
+}
+
+}  // namespace
+
+absl::StatusOr<ScenarioEngine> ScenarioEngine::Create(const RiskNode& kBook) {
+  ScenarioEngine engine;
+
+  // Depth-first with an explicit stack, children pushed in reverse so
+  // columns are numbered in pre-order.
+  std::vector<const RiskNode*> pending{&kBook};
+  while (!pending.empty()) {
+    const RiskNode* node = pending.back();
+    pending.pop_back();
+    if (const auto* stock = dynamic_cast<const Stock*>(node)) {
+      const std::string& kSymbol = stock->GetTicker().Symbol();
+      const auto [kIt, kInserted] = engine.column_by_symbol_.try_emplace(
+          kSymbol, static_cast<uint32_t>(engine.symbols_.size()));
+      if (kInserted) {
+        engine.symbols_.push_back(kSymbol);
+        engine.exposure_.push_back(0);
+      }
+      const double kValue =
+          static_cast<double>(stock->Quantity()) * stock->Price();
+      engine.exposure_[kIt->second] += kValue;
+      engine.base_ += kValue;
+    } else if (const auto* portfolio = dynamic_cast<const Portfolio*>(node)) {
+      const auto& kChildren = portfolio->Children();
+      for (auto it = kChildren.rbegin(); it != kChildren.rend(); ++it) {
+        pending.push_back(it->get());
+      }
+    } else {
+      return absl::InvalidArgumentError("node type cannot be priced");
+    }
+  }
+  return engine;
+}
+
+absl::StatusOr<std::size_t> ScenarioEngine::Column(
+    const absl::string_view kSymbol) const {
+  const auto kIt = column_by_symbol_.find(kSymbol);
+  if (kIt == column_by_symbol_.end()) {
+    return absl::NotFoundError("symbol is not in the book");
+  }
+  return kIt->second;
+}
+
+absl::Status ScenarioEngine::Evaluate(const std::span<const double> kShocks,
+                                      const std::span<double> out) const {
+  const std::size_t kColumns = SymbolCount();
+  if (kShocks.size() != out.size() * kColumns) {
+    return absl::InvalidArgumentError(
+        "shock matrix is not one row of every symbol per scenario");
+  }
+
+  const std::size_t kScenarios = out.size();
+  std::size_t s = 0;
+  for (; s + kBlock <= kScenarios; s += kBlock) {
+    EvaluateRows<NativeLanes, kBlock>(
+        exposure_, kShocks.data() + (s * kColumns), base_, &out[s]);
+  }
+  for (; s < kScenarios; ++s) {
+    EvaluateRows<NativeLanes, 1>(exposure_, kShocks.data() + (s * kColumns),
+                                 base_, &out[s]);
+  }
+  return absl::OkStatus();
+}
@@ -0,0 +1,64 @@
+#ifndef GOF23_SCENARIO_ENGINE_H
+#define GOF23_SCENARIO_ENGINE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/status/status.h>
+#include <absl/status/statusor.h>
+#include <absl/strings/string_view.h>
+
+#include "composite.h"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+// Stress scenarios against a frozen book. A scenario is one relative price
+// shock per symbol, price -> price * (1 + shock), and its result is the
+// book's NetCost under those prices.
+//
+// Every leaf of a symbol moves by the same factor, so the leaves collapse at
+// Create into one exposure (the sum of quantity x price) per symbol, laid
+// out contiguously. A scenario is then the base NetCost plus the dot
+// product of its shock row with the exposures, and Evaluate runs a block of
+// scenarios at once over SIMD lanes, each exposure load feeding every row.
+//
+// Like FlatPortfolio this is a copy: later changes to the book are not seen.
+class ScenarioEngine {
+ public:
+  // Fails on node types it does not know how to price.
+  static absl::StatusOr<ScenarioEngine> Create(const RiskNode& kBook);
+
+  // Symbols in column order: the order they were first met in pre-order.
+  [[nodiscard]] std::span<const std::string> Symbols() const {
+    return symbols_;
+  }
+  [[nodiscard]] std::size_t SymbolCount() const { return symbols_.size(); }
+
+  // Column of kSymbol in a shock row.
+  [[nodiscard]] absl::StatusOr<std::size_t> Column(
+      absl::string_view kSymbol) const;
+
+  // NetCost with no shocks applied.
+  [[nodiscard]] double BaseNetCost() const { return base_; }
+
+  // kShocks is scenario-major, SymbolCount() shocks per scenario; out gets
+  // one NetCost per scenario.
+  absl::Status Evaluate(std::span<const double> kShocks,
+                        std::span<double> out) const;
+
+ private:
+  ScenarioEngine() = default;
+
+  std::vector<std::string> symbols_;
+  absl::flat_hash_map<std::string, uint32_t> column_by_symbol_;
+  std::vector<double> exposure_;  // per column
+  double base_ = 0;
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_SCENARIO_ENGINE_H
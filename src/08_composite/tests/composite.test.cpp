@@ -4,12 +4,16 @@
 
 #include "composite.h"
 
+#include <cmath>
 #include <memory>
+#include <vector>
 
 #include <absl/status/status.h>
 #include <absl/status/statusor.h>
 #include <gtest/gtest.h>
 
+#include "node_arena.h"
+
 class CompositeSuite : public ::testing::Test {
  protected:
   static constexpr std::string kSymbol_ = "AAPL";
@@ -123,4 +127,78 @@ TEST_F(CompositeSuite, PortfolioShouldAggregateNestedPortfolio) {
   ASSERT_TRUE(parent->Add(std::move(child)).ok());
 
   EXPECT_DOUBLE_EQ(parent->NetCost(), kExpectedNetCost);
-}
\ No newline at end of file
+}
+
+TEST_F(CompositeSuite, StockUpdatesShouldReachEveryEnclosingPortfolio) {
+  auto stock_or = Stock::Create(Ticker{kSymbol_, kName_}, 10, 5.0);
+  ASSERT_TRUE(stock_or.ok());
+  Stock* const stock = stock_or->get();
+
+  std::unique_ptr<RiskNode> strategy = std::move(Portfolio::Create()).value();
+  const RiskNode* const kStrategy = strategy.get();
+  ASSERT_TRUE(strategy->Add(std::move(stock_or).value()).ok());
+  ASSERT_TRUE(strategy->Add(MakeStock(1, 7.0)).ok());
+
+  const auto root = std::move(Portfolio::Create()).value();
+  ASSERT_TRUE(root->Add(MakeStock(2, 100.0)).ok());
+  ASSERT_TRUE(root->Add(std::move(strategy)).ok());
+  EXPECT_DOUBLE_EQ(root->NetCost(), 257.0);
+
+  ASSERT_TRUE(stock->SetPrice(6.0).ok());
+  EXPECT_DOUBLE_EQ(stock->NetCost(), 60.0);
+  EXPECT_DOUBLE_EQ(kStrategy->NetCost(), 67.0);
+  EXPECT_DOUBLE_EQ(root->NetCost(), 267.0);
+
+  stock->SetQuantity(0);
+  EXPECT_DOUBLE_EQ(kStrategy->NetCost(), 7.0);
+  EXPECT_DOUBLE_EQ(root->NetCost(), 207.0);
+}
+
+TEST_F(CompositeSuite, StockSetPriceShouldRejectNonFinitePrices) {
+  auto stock_or = Stock::Create(Ticker{kSymbol_, kName_}, 10, 5.0);
+  ASSERT_TRUE(stock_or.ok());
+  Stock* const stock = stock_or->get();
+  const auto portfolio = std::move(Portfolio::Create()).value();
+  ASSERT_TRUE(portfolio->Add(std::move(stock_or).value()).ok());
+
+  const absl::Status st = stock->SetPrice(std::nan(""));
+  EXPECT_EQ(st.code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_DOUBLE_EQ(portfolio->NetCost(), 50.0);
+}
+
+TEST_F(CompositeSuite, StockCreateShouldRejectNonFinitePrices) {
+  NodeArena arena;
+  for (const double kPrice : {std::nan(""), HUGE_VAL, -HUGE_VAL}) {
+    EXPECT_EQ(Stock::Create(Ticker{kSymbol_, kName_}, 10, kPrice)
+                  .status()
+                  .code(),
+              absl::StatusCode::kInvalidArgument);
+    EXPECT_EQ(Stock::Create(arena, Ticker{kSymbol_, kName_}, 10, kPrice)
+                  .status()
+                  .code(),
+              absl::StatusCode::kInvalidArgument);
+  }
+}
+
+TEST_F(CompositeSuite, PortfolioTotalsShouldTrackAFreshSumThroughManyTicks) {
+  const auto root = std::move(Portfolio::Create()).value();
+  std::vector<Stock*> stocks;
+  for (int d = 0; d < 4; ++d) {
+    std::unique_ptr<RiskNode> desk = std::move(Portfolio::Create()).value();
+    for (int s = 0; s < 25; ++s) {
+      auto stock_or = Stock::Create(Ticker{kSymbol_, kName_}, 100, 50.0);
+      ASSERT_TRUE(stock_or.ok());
+      stocks.push_back(stock_or->get());
+      ASSERT_TRUE(desk->Add(std::move(stock_or).value()).ok());
+    }
+    ASSERT_TRUE(root->Add(std::move(desk)).ok());
+  }
+
+  for (int tick = 0; tick < 10'000; ++tick) {
+    Stock* const stock = stocks[(tick * 37) % stocks.size()];
+    ASSERT_TRUE(stock->SetPrice(40.0 + (0.01 * (tick % 2000))).ok());
+  }
+  double fresh = 0;
+  for (const Stock* const kStock : stocks) fresh += kStock->NetCost();
+  EXPECT_NEAR(root->NetCost(), fresh, 1e-6 * fresh);
+}
@@ -0,0 +1,89 @@
+#include "flat_portfolio.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <absl/status/status.h>
+#include <gtest/gtest.h>
+
+#include "composite.h"
+
+class FlatPortfolioSuite : public ::testing::Test {
+ protected:
+  static std::unique_ptr<RiskNode> MakeStock(const uint32_t kQty,
+                                             const double kPrice) {
+    return *Stock::Create(Ticker{"AAPL", "Apple"}, kQty, kPrice);
+  }
+
+  // root -> {stock 10x1, desk -> {stock 2x3, empty, strategy -> {4x5}},
+  //          stock 1x100}
+  static std::unique_ptr<RiskNode> MakeBook() {
+    std::unique_ptr<RiskNode> strategy = *Portfolio::Create();
+    EXPECT_TRUE(strategy->Add(MakeStock(4, 5)).ok());
+    std::unique_ptr<RiskNode> desk = *Portfolio::Create();
+    EXPECT_TRUE(desk->Add(MakeStock(2, 3)).ok());
+    EXPECT_TRUE(desk->Add(*Portfolio::Create()).ok());
+    EXPECT_TRUE(desk->Add(std::move(strategy)).ok());
+    std::unique_ptr<RiskNode> root = *Portfolio::Create();
+    EXPECT_TRUE(root->Add(MakeStock(10, 1)).ok());
+    EXPECT_TRUE(root->Add(std::move(desk)).ok());
+    EXPECT_TRUE(root->Add(MakeStock(1, 100)).ok());
+    return root;
+  }
+};
+
+TEST_F(FlatPortfolioSuite, ShouldMatchThePointerTree) {
+  const auto kBook = MakeBook();
+  const auto kFlat = FlatPortfolio::Compile(*kBook);
+  ASSERT_TRUE(kFlat.ok());
+  EXPECT_DOUBLE_EQ(kFlat->NetCost(), kBook->NetCost());
+  EXPECT_DOUBLE_EQ(kFlat->NetCost(), 136);
+  EXPECT_EQ(kFlat->NodeCount(), 8);
+  EXPECT_EQ(kFlat->LeafCount(), 4);
+}
+
+TEST_F(FlatPortfolioSuite, ShouldLayOutSubtreesContiguously) {
+  const auto kFlat = *FlatPortfolio::Compile(*MakeBook());
+  // Pre-order: 0 root, 1 stock, 2 desk, 3 stock, 4 empty, 5 strategy,
+  // 6 stock, 7 stock.
+  const std::vector<FlatPortfolio::NodeId> kParents{0, 0, 0, 2, 2, 2, 5, 0};
+  const std::vector<FlatPortfolio::NodeId> kEnds{8, 2, 7, 4, 5, 7, 7, 8};
+  for (FlatPortfolio::NodeId id = 0; id < kFlat.NodeCount(); ++id) {
+    EXPECT_EQ(kFlat.Parent(id), kParents[id]) << id;
+    EXPECT_EQ(kFlat.SubtreeEnd(id), kEnds[id]) << id;
+  }
+  EXPECT_TRUE(kFlat.IsLeaf(6));
+  EXPECT_FALSE(kFlat.IsLeaf(4));
+  EXPECT_DOUBLE_EQ(kFlat.NetCost(2), 26);
+  EXPECT_DOUBLE_EQ(kFlat.NetCost(4), 0);
+  EXPECT_DOUBLE_EQ(kFlat.NetCost(5), 20);
+}
+
+TEST_F(FlatPortfolioSuite, ShouldTotalEverySubtreeInOnePass) {
+  const auto kFlat = *FlatPortfolio::Compile(*MakeBook());
+  const std::vector<double> kTotals = kFlat.SubtreeTotals();
+  ASSERT_EQ(kTotals.size(), kFlat.NodeCount());
+  for (FlatPortfolio::NodeId id = 0; id < kFlat.NodeCount(); ++id) {
+    EXPECT_DOUBLE_EQ(kTotals[id], kFlat.NetCost(id)) << id;
+  }
+}
+
+TEST_F(FlatPortfolioSuite, ShouldFlattenASingleLeaf) {
+  const auto kFlat = *FlatPortfolio::Compile(*MakeStock(3, 7));
+  EXPECT_EQ(kFlat.NodeCount(), 1);
+  EXPECT_DOUBLE_EQ(kFlat.NetCost(), 21);
+  EXPECT_EQ(kFlat.SubtreeTotals(), std::vector<double>{21});
+}
+
+TEST_F(FlatPortfolioSuite, ShouldRejectUnknownNodeTypes) {
+  struct Opaque final : RiskNode {
+    [[nodiscard]] double NetCost() const override { return 1; }
+    [[nodiscard]] std::string ToString() const override { return "?"; }
+  };
+  std::unique_ptr<RiskNode> root = *Portfolio::Create();
+  ASSERT_TRUE(root->Add(std::make_unique<Opaque>()).ok());
+  EXPECT_EQ(FlatPortfolio::Compile(*root).status().code(),
+            absl::StatusCode::kInvalidArgument);
+}
@@ -0,0 +1,101 @@
+#include "node_arena.h"
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "composite.h"
+
+class NodeArenaSuite : public ::testing::Test {
+ protected:
+  // Three strategies of kStocks stocks each, built on the heap or, when
+  // arena is given, in it.
+  static std::unique_ptr<RiskNode> MakeBook(NodeArena* arena) {
+    const auto kPortfolio = [arena]() -> std::unique_ptr<RiskNode> {
+      return std::move(arena != nullptr ? Portfolio::Create(*arena)
+                                        : Portfolio::Create())
+          .value();
+    };
+    std::unique_ptr<RiskNode> root = kPortfolio();
+    for (uint32_t s = 0; s < 3; ++s) {
+      std::unique_ptr<RiskNode> strategy = kPortfolio();
+      for (uint32_t i = 0; i < kStocks; ++i) {
+        EXPECT_TRUE(strategy->Add(MakeStock(arena, s + i, 0.25 * i)).ok());
+      }
+      EXPECT_TRUE(root->Add(std::move(strategy)).ok());
+    }
+    return root;
+  }
+
+  static std::unique_ptr<RiskNode> MakeStock(NodeArena* arena,
+                                             const uint32_t kQty,
+                                             const double kPrice) {
+    Ticker ticker{"AAPL", "Apple"};
+    return std::move(arena != nullptr
+                         ? Stock::Create(*arena, std::move(ticker), kQty,
+                                         kPrice)
+                         : Stock::Create(std::move(ticker), kQty, kPrice))
+        .value();
+  }
+
+  static constexpr uint32_t kStocks = 500;
+};
+
+TEST_F(NodeArenaSuite, ShouldBuildTheSameTreeAsTheHeap) {
+  NodeArena arena;
+  const auto kHeap = MakeBook(nullptr);
+  const auto kPacked = MakeBook(&arena);
+  EXPECT_DOUBLE_EQ(kPacked->NetCost(), kHeap->NetCost());
+  EXPECT_EQ(kPacked->SubtreeSize(), kHeap->SubtreeSize());
+  EXPECT_EQ(kPacked->ToString(), kHeap->ToString());
+}
+
+TEST_F(NodeArenaSuite, ShouldCountTheBytesHandedOut) {
+  NodeArena arena(256);
+  EXPECT_EQ(arena.BytesAllocated(), 0U);
+  const auto kBook = MakeBook(&arena);
+  EXPECT_GE(arena.BytesAllocated(),
+            (3 * kStocks * sizeof(Stock)) + (4 * sizeof(Portfolio)));
+}
+
+TEST_F(NodeArenaSuite, ShouldMixHeapAndArenaNodes) {
+  NodeArena arena;
+  std::unique_ptr<RiskNode> root = std::move(Portfolio::Create()).value();
+  ASSERT_TRUE(root->Add(MakeStock(&arena, 2, 10.0)).ok());
+  ASSERT_TRUE(root->Add(MakeStock(nullptr, 3, 10.0)).ok());
+
+  std::unique_ptr<RiskNode> desk = std::move(Portfolio::Create(arena)).value();
+  ASSERT_TRUE(desk->Add(MakeStock(nullptr, 5, 10.0)).ok());
+  ASSERT_TRUE(root->Add(std::move(desk)).ok());
+  EXPECT_DOUBLE_EQ(root->NetCost(), 100.0);
+  EXPECT_EQ(root->SubtreeSize(), 5U);
+}
+
+TEST_F(NodeArenaSuite, ShouldRunDestructorsOfArenaNodes) {
+  NodeArena arena;
+  std::unique_ptr<Stock> stock =
+      std::move(Stock::Create(arena, Ticker{"AAPL", "Apple"}, 4, 2.0)).value();
+  auto* const kStock = stock.get();
+  std::unique_ptr<RiskNode> root = std::move(Portfolio::Create(arena)).value();
+  ASSERT_TRUE(root->Add(std::move(stock)).ok());
+  ASSERT_TRUE(kStock->SetPrice(3.0).ok());
+  EXPECT_DOUBLE_EQ(root->NetCost(), 12.0);
+  root.reset();  // frees the children_ vector; the arena keeps the nodes
+  EXPECT_GT(arena.BytesAllocated(), 0U);
+}
+
+TEST_F(NodeArenaSuite, ShouldCatchANodeThatOutlivesItsArena) {
+  EXPECT_DEBUG_DEATH(
+      {
+        auto arena = std::make_unique<NodeArena>();
+        std::unique_ptr<Stock> stock =
+            std::move(Stock::Create(*arena, Ticker{"AAPL", "Apple"}, 1, 1.0))
+                .value();
+        arena.reset();
+        // Release builds do not check; drop the dangling node unread.
+        static_cast<void>(stock.release());
+      },
+      "outlived its NodeArena");
+}
@@ -0,0 +1,94 @@
+#include "parallel_rollup.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "composite.h"
+
+class ParallelRollupSuite : public ::testing::Test {
+ protected:
+  // A lopsided book: one desk holds a deep chain of strategies, the other
+  // a wide flat list, and an empty desk sits between them.
+  static std::unique_ptr<RiskNode> MakeBook() {
+    std::unique_ptr<RiskNode> root = std::move(Portfolio::Create()).value();
+
+    std::unique_ptr<RiskNode> chain = std::move(Portfolio::Create()).value();
+    for (uint32_t level = 0; level < 200; ++level) {
+      std::unique_ptr<RiskNode> outer = std::move(Portfolio::Create()).value();
+      EXPECT_TRUE(outer->Add(MakeStock(level + 1, 0.5)).ok());
+      EXPECT_TRUE(outer->Add(std::move(chain)).ok());
+      chain = std::move(outer);
+    }
+    EXPECT_TRUE(root->Add(std::move(chain)).ok());
+    EXPECT_TRUE(root->Add(std::move(Portfolio::Create()).value()).ok());
+
+    std::unique_ptr<RiskNode> wide = std::move(Portfolio::Create()).value();
+    for (uint32_t i = 0; i < 3000; ++i) {
+      EXPECT_TRUE(wide->Add(MakeStock(i % 17, 1.25)).ok());
+    }
+    EXPECT_TRUE(root->Add(std::move(wide)).ok());
+    return root;
+  }
+
+  static std::unique_ptr<RiskNode> MakeStock(const uint32_t kQty,
+                                             const double kPrice) {
+    return std::move(Stock::Create(Ticker{"AAPL", "Apple"}, kQty, kPrice))
+        .value();
+  }
+
+  static ParallelRollup::Options Small(const unsigned kThreads) {
+    ParallelRollup::Options options;
+    options.threshold_ = 64;
+    options.threads_ = kThreads;
+    return options;
+  }
+};
+
+TEST_F(ParallelRollupSuite, ShouldTrackSubtreeSizes) {
+  const auto kBook = MakeBook();
+  EXPECT_EQ(kBook->SubtreeSize(), 1 + (200 * 2 + 1) + 1 + (1 + 3000));
+}
+
+TEST_F(ParallelRollupSuite, ShouldMatchTheCachedNetCostOnAnyThreadCount) {
+  const auto kBook = MakeBook();
+  for (const unsigned kThreads : {1U, 2U, 4U, 7U}) {
+    ParallelRollup rollup(Small(kThreads));
+    EXPECT_DOUBLE_EQ(rollup.NetCost(*kBook), kBook->NetCost()) << kThreads;
+  }
+}
+
+TEST_F(ParallelRollupSuite, ShouldCombineInChildOrder) {
+  const auto kBook = MakeBook();
+  // Concatenating leaf quantities is associative but not commutative.
+  const auto kLeaf = [](const RiskNode& kNode) {
+    return std::to_string(dynamic_cast<const Stock&>(kNode).Quantity()) + ",";
+  };
+  const auto kConcat = [](std::string a, const std::string& kB) {
+    return std::move(a) + kB;
+  };
+  ParallelRollup serial(Small(1));
+  const std::string kExpected =
+      serial.Fold(*kBook, std::string{}, kLeaf, kConcat);
+  ParallelRollup parallel(Small(4));
+  EXPECT_EQ(parallel.Fold(*kBook, std::string{}, kLeaf, kConcat), kExpected);
+}
+
+TEST_F(ParallelRollupSuite, ShouldFoldLeavesAndEmptyPortfolios) {
+  ParallelRollup rollup(Small(4));
+  EXPECT_DOUBLE_EQ(rollup.NetCost(*MakeStock(3, 2)), 6);
+  EXPECT_DOUBLE_EQ(rollup.NetCost(*std::move(Portfolio::Create()).value()), 0);
+
+  const auto kBook = MakeBook();
+  const auto kMaxPrice = rollup.Fold(
+      *kBook, 0.0,
+      [](const RiskNode& kNode) {
+        return dynamic_cast<const Stock&>(kNode).Price();
+      },
+      [](const double kA, const double kB) { return std::max(kA, kB); });
+  EXPECT_DOUBLE_EQ(kMaxPrice, 1.25);
+}
@@ -0,0 +1,134 @@
+#include "portfolio_snapshot.h"
+
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include <absl/status/status.h>
+#include <absl/strings/str_cat.h>
+#include <gtest/gtest.h>
+
+#include "composite.h"
+#include "node_arena.h"
+
+class PortfolioSnapshotSuite : public ::testing::Test {
+ protected:
+  // A root holding a stock, an empty portfolio and two desks that trade
+  // the same three tickers, one desk nested a level deeper.
+  static std::unique_ptr<RiskNode> MakeBook() {
+    std::unique_ptr<RiskNode> root = std::move(Portfolio::Create()).value();
+    EXPECT_TRUE(root->Add(MakeStock("AAPL", "Apple", 10, 180.25)).ok());
+    EXPECT_TRUE(root->Add(std::move(Portfolio::Create()).value()).ok());
+    for (int d = 0; d < 2; ++d) {
+      std::unique_ptr<RiskNode> desk = std::move(Portfolio::Create()).value();
+      EXPECT_TRUE(desk->Add(MakeStock("AAPL", "Apple", 3 + d, 181.5)).ok());
+      EXPECT_TRUE(desk->Add(MakeStock("MSFT", "Microsoft", 7, 410.0)).ok());
+      std::unique_ptr<RiskNode> inner = std::move(Portfolio::Create()).value();
+      EXPECT_TRUE(inner->Add(MakeStock("IBM", "IBM", 100 * d, 0.5)).ok());
+      EXPECT_TRUE(desk->Add(std::move(inner)).ok());
+      EXPECT_TRUE(root->Add(std::move(desk)).ok());
+    }
+    return root;
+  }
+
+  static std::unique_ptr<RiskNode> MakeStock(const std::string& kSymbol,
+                                             const std::string& kName,
+                                             const uint32_t kQty,
+                                             const double kPrice) {
+    return std::move(Stock::Create(Ticker{kSymbol, kName}, kQty, kPrice))
+        .value();
+  }
+
+  static std::string Path(const std::string& kName) {
+    return absl::StrCat(::testing::TempDir(), "/", kName, ".snapshot");
+  }
+
+  static void Save(const std::string& kPath, const std::string& kBytes) {
+    std::ofstream file(kPath, std::ios::binary | std::ios::trunc);
+    file.write(kBytes.data(), static_cast<std::streamsize>(kBytes.size()));
+    ASSERT_TRUE(file.good());
+  }
+
+  static std::string Image(const RiskNode& kRoot) {
+    std::ostringstream image;
+    EXPECT_TRUE(PortfolioSnapshot::Write(kRoot, image).ok());
+    return std::move(image).str();
+  }
+};
+
+TEST_F(PortfolioSnapshotSuite, ShouldRoundTripATree) {
+  const auto kBook = MakeBook();
+  const std::string kPath = Path("round_trip");
+  Save(kPath, Image(*kBook));
+
+  const auto kSnapshot = std::move(PortfolioSnapshot::Open(kPath)).value();
+  EXPECT_EQ(kSnapshot->NodeCount(), kBook->SubtreeSize());
+  EXPECT_EQ(kSnapshot->TickerCount(), 3U);
+  EXPECT_DOUBLE_EQ(kSnapshot->NetCost(), kBook->NetCost());
+
+  const auto kRebuilt = std::move(kSnapshot->Materialize()).value();
+  EXPECT_EQ(kRebuilt->ToString(), kBook->ToString());
+  EXPECT_EQ(kRebuilt->SubtreeSize(), kBook->SubtreeSize());
+  EXPECT_DOUBLE_EQ(kRebuilt->NetCost(), kBook->NetCost());
+}
+
+TEST_F(PortfolioSnapshotSuite, ShouldReadNodesInBreadthFirstOrder) {
+  const auto kBook = MakeBook();
+  const std::string kPath = Path("layout");
+  Save(kPath, Image(*kBook));
+  const auto kSnapshot = std::move(PortfolioSnapshot::Open(kPath)).value();
+
+  ASSERT_TRUE(kSnapshot->IsPortfolio(PortfolioSnapshot::kRoot));
+  ASSERT_EQ(kSnapshot->ChildCount(PortfolioSnapshot::kRoot), 4U);
+  const auto kFirst = kSnapshot->FirstChild(PortfolioSnapshot::kRoot);
+  EXPECT_EQ(kFirst, 1U);
+  EXPECT_EQ(kSnapshot->Symbol(kFirst), "AAPL");
+  EXPECT_EQ(kSnapshot->Name(kFirst), "Apple");
+  EXPECT_EQ(kSnapshot->Quantity(kFirst), 10U);
+  EXPECT_EQ(kSnapshot->Price(kFirst), 180.25);
+  EXPECT_TRUE(kSnapshot->IsPortfolio(kFirst + 1));
+  EXPECT_EQ(kSnapshot->ChildCount(kFirst + 1), 0U);
+  EXPECT_EQ(kSnapshot->Symbol(kFirst + 1), "");
+}
+
+TEST_F(PortfolioSnapshotSuite, ShouldMaterializeIntoAnArena) {
+  const auto kBook = MakeBook();
+  const std::string kPath = Path("arena");
+  Save(kPath, Image(*kBook));
+  const auto kSnapshot = std::move(PortfolioSnapshot::Open(kPath)).value();
+
+  NodeArena arena;
+  const auto kRebuilt = std::move(kSnapshot->Materialize(&arena)).value();
+  EXPECT_GT(arena.BytesAllocated(), 0U);
+  EXPECT_EQ(kRebuilt->ToString(), kBook->ToString());
+}
+
+TEST_F(PortfolioSnapshotSuite, ShouldRejectBadFiles) {
+  EXPECT_EQ(PortfolioSnapshot::Open(Path("missing")).status().code(),
+            absl::StatusCode::kNotFound);
+
+  const std::string kImage = Image(*MakeBook());
+  const std::string kTruncated = Path("truncated");
+  Save(kTruncated, kImage.substr(0, kImage.size() - 1));
+  EXPECT_EQ(PortfolioSnapshot::Open(kTruncated).status().code(),
+            absl::StatusCode::kDataLoss);
+
+  std::string garbage = kImage;
+  garbage[0] = 'X';
+  const std::string kGarbage = Path("garbage");
+  Save(kGarbage, garbage);
+  EXPECT_EQ(PortfolioSnapshot::Open(kGarbage).status().code(),
+            absl::StatusCode::kDataLoss);
+
+  // The root's first child pointed back at the root: a cycle.
+  std::string cyclic = kImage;
+  const std::size_t kRootRecord = 32 + (3 * 16);
+  cyclic[kRootRecord + 16] = 0;
+  const std::string kCyclic = Path("cyclic");
+  Save(kCyclic, cyclic);
+  EXPECT_EQ(PortfolioSnapshot::Open(kCyclic).status().code(),
+            absl::StatusCode::kDataLoss);
+}
@@ -0,0 +1,115 @@
+#include "risk_visitor.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <absl/status/status.h>
+#include <absl/strings/str_cat.h>
+#include <gtest/gtest.h>
+
+#include "composite.h"
+
+class RiskVisitorSuite : public ::testing::Test {
+ protected:
+  // root: AAPL x 10, desk (MSFT x 2, AAPL x 1, empty), IBM x 4.
+  void SetUp() override {
+    root_ = std::move(Portfolio::Create()).value();
+    ASSERT_TRUE(root_->Add(MakeStock("AAPL", 10, 5.0)).ok());
+    std::unique_ptr<RiskNode> desk = std::move(Portfolio::Create()).value();
+    ASSERT_TRUE(desk->Add(MakeStock("MSFT", 2, 100.0)).ok());
+    ASSERT_TRUE(desk->Add(MakeStock("AAPL", 1, 6.0)).ok());
+    ASSERT_TRUE(desk->Add(std::move(Portfolio::Create()).value()).ok());
+    ASSERT_TRUE(root_->Add(std::move(desk)).ok());
+    ASSERT_TRUE(root_->Add(MakeStock("IBM", 4, 2.5)).ok());
+  }
+
+  static std::unique_ptr<RiskNode> MakeStock(const std::string& kSymbol,
+                                             const uint32_t kQty,
+                                             const double kPrice) {
+    return std::move(Stock::Create(Ticker{kSymbol, kSymbol}, kQty, kPrice))
+        .value();
+  }
+
+  // Writes the hooks it sees as one line: "<" and ">" for entering and
+  // leaving a portfolio, the symbol for a stock, "?" for anything else.
+  struct Trace final : RiskVisitor {
+    void VisitStock(const Stock& kStock) override {
+      absl::StrAppend(&trace_, kStock.GetTicker().Symbol(), " ");
+    }
+    void EnterPortfolio(const Portfolio& /*portfolio*/) override {
+      trace_ += "< ";
+    }
+    void LeavePortfolio(const Portfolio& /*portfolio*/) override {
+      trace_ += "> ";
+    }
+    void VisitOther(const RiskNode& /*node*/) override { trace_ += "? "; }
+    std::string trace_;
+  };
+
+  std::unique_ptr<RiskNode> root_;
+};
+
+TEST_F(RiskVisitorSuite, ShouldVisitDepthFirstInChildOrder) {
+  Trace trace;
+  root_->Accept(trace);
+  EXPECT_EQ(trace.trace_, "< AAPL < MSFT AAPL < > > IBM > ");
+}
+
+TEST_F(RiskVisitorSuite, ShouldFuseAggregationsIntoOneWalk) {
+  NetCostVisitor net_cost;
+  GrossExposureVisitor gross;
+  PositionCountVisitor positions;
+  SymbolTotalsVisitor symbols;
+  VisitorGroup group({&net_cost, &gross, &positions, &symbols});
+  WalkRiskTree(*root_, group);
+
+  EXPECT_DOUBLE_EQ(net_cost.Total(), root_->NetCost());
+  EXPECT_DOUBLE_EQ(gross.Total(), 266.0);
+  EXPECT_EQ(positions.Count(), 4U);
+  ASSERT_EQ(symbols.Totals().size(), 3U);
+  EXPECT_DOUBLE_EQ(symbols.Totals().at("AAPL"), 56.0);
+  EXPECT_DOUBLE_EQ(symbols.Totals().at("MSFT"), 200.0);
+  EXPECT_DOUBLE_EQ(symbols.Totals().at("IBM"), 10.0);
+}
+
+TEST_F(RiskVisitorSuite, ShouldCountNegativePricesAgainstGrossExposure) {
+  ASSERT_TRUE(root_->Add(MakeStock("CL", 3, -2.0)).ok());
+  NetCostVisitor net_cost;
+  GrossExposureVisitor gross;
+  VisitorGroup group({&net_cost, &gross});
+  WalkRiskTree(*root_, group);
+  EXPECT_DOUBLE_EQ(net_cost.Total(), 260.0);
+  EXPECT_DOUBLE_EQ(gross.Total(), 272.0);
+}
+
+TEST_F(RiskVisitorSuite, ShouldWalkADeepTreeWithoutRecursion) {
+  constexpr int kDepth = 10000;
+  std::unique_ptr<RiskNode> chain = MakeStock("AAPL", 1, 1.0);
+  for (int level = 0; level < kDepth; ++level) {
+    std::unique_ptr<RiskNode> outer = std::move(Portfolio::Create()).value();
+    ASSERT_TRUE(outer->Add(std::move(chain)).ok());
+    chain = std::move(outer);
+  }
+
+  PositionCountVisitor positions;
+  NetCostVisitor net_cost;
+  VisitorGroup group({&positions, &net_cost});
+  chain->Accept(group);
+  EXPECT_EQ(positions.Count(), 1U);
+  EXPECT_DOUBLE_EQ(net_cost.Total(), 1.0);
+}
+
+TEST_F(RiskVisitorSuite, ShouldSendUnknownNodesToVisitOther) {
+  struct Opaque final : RiskNode {
+    [[nodiscard]] double NetCost() const override { return 0; }
+    [[nodiscard]] std::string ToString() const override { return "?"; }
+  };
+  std::unique_ptr<RiskNode> root = std::move(Portfolio::Create()).value();
+  ASSERT_TRUE(root->Add(std::make_unique<Opaque>()).ok());
+  ASSERT_TRUE(root->Add(MakeStock("IBM", 1, 1.0)).ok());
+
+  Trace trace;
+  WalkRiskTree(*root, trace);
+  EXPECT_EQ(trace.trace_, "< ? IBM > ");
+}
@@ -0,0 +1,128 @@
+#include "scenario_engine.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <absl/status/status.h>
+#include <absl/strings/str_cat.h>
+#include <gtest/gtest.h>
+
+#include "composite.h"
+
+class ScenarioEngineSuite : public ::testing::Test {
+ protected:
+  // Two desks holding kSymbols symbols between them, most symbols in both.
+  void SetUp() override {
+    root_ = std::move(Portfolio::Create()).value();
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<uint32_t> quantity(1, 100);
+    std::uniform_real_distribution<double> price(5, 50);
+    for (int d = 0; d < 2; ++d) {
+      std::unique_ptr<RiskNode> desk = std::move(Portfolio::Create()).value();
+      for (std::size_t i = 0; i < 3 * kSymbols; ++i) {
+        const uint32_t kQuantity = quantity(rng);
+        const double kPrice = price(rng);
+        auto stock = std::move(Stock::Create(Ticker{Symbol(i % kSymbols), "X"},
+                                             kQuantity, kPrice))
+                         .value();
+        stocks_.push_back(stock.get());
+        ASSERT_TRUE(desk->Add(std::move(stock)).ok());
+      }
+      ASSERT_TRUE(root_->Add(std::move(desk)).ok());
+    }
+  }
+
+  static std::string Symbol(const std::size_t kIndex) {
+    return absl::StrCat("S", kIndex);
+  }
+
+  // NetCost of the scenario the slow way: reprice every stock in the tree.
+  double Revalue(const ScenarioEngine& kEngine,
+                 const std::span<const double> kShocks) {
+    std::vector<double> before;
+    for (Stock* stock : stocks_) {
+      before.push_back(stock->Price());
+      const std::size_t kColumn =
+          kEngine.Column(stock->GetTicker().Symbol()).value();
+      EXPECT_TRUE(
+          stock->SetPrice(stock->Price() * (1 + kShocks[kColumn])).ok());
+    }
+    const double kNetCost = root_->NetCost();
+    for (std::size_t i = 0; i < stocks_.size(); ++i) {
+      EXPECT_TRUE(stocks_[i]->SetPrice(before[i]).ok());
+    }
+    return kNetCost;
+  }
+
+  static constexpr std::size_t kSymbols = 37;  // not a multiple of any width
+  std::unique_ptr<Portfolio> root_;
+  std::vector<Stock*> stocks_;
+};
+
+TEST_F(ScenarioEngineSuite, ShouldMatchRepricingTheTree) {
+  const ScenarioEngine kEngine = ScenarioEngine::Create(*root_).value();
+  ASSERT_EQ(kEngine.SymbolCount(), kSymbols);
+
+  constexpr std::size_t kScenarios = 11;  // a partial block at the end
+  std::mt19937_64 rng(11);
+  std::uniform_real_distribution<double> shock(-0.3, 0.3);
+  std::vector<double> shocks(kScenarios * kSymbols);
+  for (double& value : shocks) value = shock(rng);
+
+  std::vector<double> out(kScenarios);
+  ASSERT_TRUE(kEngine.Evaluate(shocks, out).ok());
+  for (std::size_t s = 0; s < kScenarios; ++s) {
+    const double kExpected = Revalue(
+        kEngine, std::span<const double>(shocks).subspan(s * kSymbols,
+                                                         kSymbols));
+    EXPECT_NEAR(out[s], kExpected, 1e-9 * kExpected) << "scenario " << s;
+  }
+}
+
+TEST_F(ScenarioEngineSuite, ShouldReturnTheBaseForAZeroShock) {
+  const ScenarioEngine kEngine = ScenarioEngine::Create(*root_).value();
+  EXPECT_NEAR(kEngine.BaseNetCost(), root_->NetCost(),
+              1e-12 * root_->NetCost());
+
+  std::vector<double> shocks(kSymbols, 0.0);
+  const std::size_t kColumn = kEngine.Column(Symbol(5)).value();
+  shocks[kColumn] = -1.0;  // S5 goes to zero
+  std::vector<double> out(2);
+  std::vector<double> both(shocks.size() * 2, 0.0);
+  std::copy(shocks.begin(), shocks.end(), both.begin() + kSymbols);
+  ASSERT_TRUE(kEngine.Evaluate(both, out).ok());
+  EXPECT_EQ(out[0], kEngine.BaseNetCost());
+
+  double without = 0;
+  for (const Stock* stock : stocks_) {
+    if (stock->GetTicker().Symbol() != Symbol(5)) {
+      without += stock->Quantity() * stock->Price();
+    }
+  }
+  EXPECT_NEAR(out[1], without, 1e-9 * without);
+}
+
+TEST_F(ScenarioEngineSuite, ShouldRejectAMisshapenShockMatrix) {
+  const ScenarioEngine kEngine = ScenarioEngine::Create(*root_).value();
+  std::vector<double> shocks(kSymbols * 2 + 1);
+  std::vector<double> out(2);
+  EXPECT_EQ(kEngine.Evaluate(shocks, out).code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(kEngine.Column("NOPE").status().code(),
+            absl::StatusCode::kNotFound);
+}
+
+TEST_F(ScenarioEngineSuite, ShouldHandleAnEmptyBook) {
+  const auto kEmpty = std::move(Portfolio::Create()).value();
+  const ScenarioEngine kEngine = ScenarioEngine::Create(*kEmpty).value();
+  EXPECT_EQ(kEngine.SymbolCount(), 0U);
+  std::vector<double> out(3, -1.0);
+  ASSERT_TRUE(kEngine.Evaluate({}, out).ok());
+  EXPECT_EQ(out, std::vector<double>(3, 0.0));
+}
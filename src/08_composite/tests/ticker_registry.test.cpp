@@ -0,0 +1,78 @@
+#include "ticker_registry.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <absl/strings/str_cat.h>
+#include <gtest/gtest.h>
+
+#include "composite.h"
+
+class TickerRegistrySuite : public ::testing::Test {
+ protected:
+  TickerRegistry registry_;
+};
+
+TEST_F(TickerRegistrySuite, ShouldGiveOneIdPerSymbolAndName) {
+  const TickerId kApple = registry_.Intern(Ticker{"AAPL", "Apple"}).value();
+  EXPECT_EQ(registry_.Intern(Ticker{"AAPL", "Apple"}).value(), kApple);
+  const TickerId kRenamed =
+      registry_.Intern(Ticker{"AAPL", "Apple Inc."}).value();
+  EXPECT_NE(kRenamed, kApple);
+  EXPECT_EQ(registry_.Size(), 2U);
+  EXPECT_EQ(registry_.Resolve(kApple).Symbol(), "AAPL");
+  EXPECT_EQ(registry_.Resolve(kRenamed).Name(), "Apple Inc.");
+}
+
+TEST_F(TickerRegistrySuite, ShouldKeepTickersInPlaceAsItGrows) {
+  const TickerId kFirst = registry_.Intern(Ticker{"S0", "first"}).value();
+  const Ticker* const kAddress = &registry_.Resolve(kFirst);
+  const std::size_t kBytes = registry_.BytesUsed();
+  for (int i = 1; i < 10000; ++i) {  // a few chunks' worth
+    ASSERT_EQ(registry_.Intern(Ticker{absl::StrCat("S", i), "x"}).value(),
+              static_cast<TickerId>(i));
+  }
+  EXPECT_EQ(&registry_.Resolve(kFirst), kAddress);
+  EXPECT_EQ(registry_.Resolve(9999).Symbol(), "S9999");
+  EXPECT_GT(registry_.BytesUsed(), kBytes);
+}
+
+TEST_F(TickerRegistrySuite, ShouldInternFromSeveralThreads) {
+  constexpr int kThreads = 4;
+  constexpr int kSymbols = 2000;
+  std::vector<std::vector<TickerId>> ids(kThreads);
+  {
+    std::vector<std::jthread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+      threads.emplace_back([&, t] {
+        for (int i = 0; i < kSymbols; ++i) {
+          const int kSymbol = (t % 2 == 0) ? i : kSymbols - 1 - i;
+          ids[t].push_back(
+              registry_.Intern(Ticker{absl::StrCat("S", kSymbol), "x"})
+                  .value());
+        }
+      });
+    }
+  }
+  EXPECT_EQ(registry_.Size(), static_cast<std::size_t>(kSymbols));
+  for (int i = 0; i < kSymbols; ++i) {
+    EXPECT_EQ(registry_.Resolve(ids[0][i]).Symbol(), absl::StrCat("S", i));
+    EXPECT_EQ(ids[1][kSymbols - 1 - i], ids[0][i]);
+  }
+}
+
+TEST_F(TickerRegistrySuite, ShouldShareOneTickerAcrossStocks) {
+  auto first = std::move(Stock::Create(Ticker{"MSFT", "Microsoft"}, 1, 2.0))
+                   .value();
+  auto second = std::move(Stock::Create(Ticker{"MSFT", "Microsoft"}, 3, 4.0))
+                    .value();
+  EXPECT_EQ(first->GetTickerId(), second->GetTickerId());
+  EXPECT_EQ(&first->GetTicker(), &second->GetTicker());
+  EXPECT_EQ(&first->GetTicker(),
+            &TickerRegistry::Global().Resolve(first->GetTickerId()));
+  EXPECT_EQ(second->ToString(), "Microsoft (MSFT) @ $4.0000 x 3");
+}
@@ -0,0 +1,73 @@
+#include "tree_writer.h"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include <absl/status/status.h>
+#include <gtest/gtest.h>
+
+#include "composite.h"
+
+class TreeWriterSuite : public ::testing::Test {
+ protected:
+  static std::unique_ptr<RiskNode> MakeStock(const uint32_t kQty,
+                                             const double kPrice) {
+    return std::move(Stock::Create(Ticker{"AAPL", "Apple"}, kQty, kPrice))
+        .value();
+  }
+
+  // root -> {stock, desk -> {stock, empty}}
+  static std::unique_ptr<RiskNode> MakeBook() {
+    std::unique_ptr<RiskNode> desk = std::move(Portfolio::Create()).value();
+    EXPECT_TRUE(desk->Add(MakeStock(2, 3)).ok());
+    EXPECT_TRUE(desk->Add(std::move(Portfolio::Create()).value()).ok());
+    std::unique_ptr<RiskNode> root = std::move(Portfolio::Create()).value();
+    EXPECT_TRUE(root->Add(MakeStock(50, 100)).ok());
+    EXPECT_TRUE(root->Add(std::move(desk)).ok());
+    return root;
+  }
+
+  static constexpr const char* kDump =
+      "Portfolio:\n"
+      "  Apple (AAPL) @ $100.0000 x 50\n"
+      "  Portfolio:\n"
+      "    Apple (AAPL) @ $3.0000 x 2\n"
+      "    Portfolio:\n";
+};
+
+TEST_F(TreeWriterSuite, ShouldIndentByDepth) {
+  const TreeWriter kWriter;
+  std::string out = "keep:";
+  kWriter.Append(*MakeBook(), out);
+  EXPECT_EQ(out, std::string("keep:") + kDump);
+}
+
+TEST_F(TreeWriterSuite, ShouldStreamTheSameDumpThroughASmallBuffer) {
+  TreeWriter::Options options;
+  options.flush_bytes_ = 8;
+  TreeWriter writer(options);
+  std::ostringstream sink;
+  ASSERT_TRUE(writer.Write(*MakeBook(), sink).ok());
+  EXPECT_EQ(sink.str(), kDump);
+}
+
+TEST_F(TreeWriterSuite, ShouldReportAFailedSink) {
+  TreeWriter writer;
+  std::ostringstream sink;
+  sink.setstate(std::ios::badbit);
+  EXPECT_EQ(writer.Write(*MakeBook(), sink).code(),
+            absl::StatusCode::kDataLoss);
+}
+
+TEST_F(TreeWriterSuite, ToStringShouldKeepItsFormat) {
+  EXPECT_EQ(MakeBook()->ToString(),
+            "Portfolio:\n"
+            "Apple (AAPL) @ $100.0000 x 50\n"
+            "Portfolio:\n"
+            "Apple (AAPL) @ $3.0000 x 2\n"
+            "Portfolio:\n"
+            "\n"
+            "\n");
+}
@@ -0,0 +1,79 @@
+#include "ticker_registry.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+
+#include <absl/status/status.h>
+#include <absl/status/statusor.h>
+
+namespace {
+
+// Bytes a string holds on the heap, zero while it fits inline.
+std::size_t HeapBytes(const std::string& kText) {
+  return kText.capacity() > std::string().capacity() ? kText.capacity() + 1
+                                                     : 0;
+}
+
+}  // namespace
+
+TickerRegistry& TickerRegistry::Global() {
+  static TickerRegistry registry;
+  return registry;
+}
+
+TickerRegistry::TickerRegistry()
+    : chunks_(std::make_unique<std::atomic<Ticker*>[]>(kMaxChunks)) {}
+
+TickerRegistry::~TickerRegistry() {
+  for (std::size_t id = 0; id < size_; ++id) {
+    std::destroy_at(&Resolve(static_cast<TickerId>(id)));
+  }
+  for (std::size_t c = 0; c < kMaxChunks; ++c) {
+    if (Ticker* chunk = chunks_[c].load(std::memory_order_relaxed)) {
+      ::operator delete(chunk);
+    }
+  }
+}
+
+absl::StatusOr<TickerId> TickerRegistry::Intern(const Ticker& kTicker) {
+  const std::scoped_lock kLock(mutex_);
+  if (const auto kIt = ids_.find(Key(kTicker.Symbol(), kTicker.Name()));
+      kIt != ids_.end()) {
+    return kIt->second;
+  }
+  if (size_ == kChunkSize * kMaxChunks) {
+    return absl::ResourceExhaustedError("ticker registry is full");
+  }
+
+  const auto kId = static_cast<TickerId>(size_);
+  std::atomic<Ticker*>& slot = chunks_[kId >> kChunkBits];
+  Ticker* chunk = slot.load(std::memory_order_relaxed);
+  if (chunk == nullptr) {
+    chunk = static_cast<Ticker*>(::operator new(kChunkSize * sizeof(Ticker)));
+    slot.store(chunk, std::memory_order_release);
+  }
+  const Ticker* kStored =
+      std::construct_at(chunk + (kId & (kChunkSize - 1)), kTicker);
+  ids_.emplace(Key(kStored->Symbol(), kStored->Name()), kId);
+  string_bytes_ += HeapBytes(kStored->Symbol()) + HeapBytes(kStored->Name());
+  ++size_;
+  return kId;
+}
+
+std::size_t TickerRegistry::Size() const {
+  const std::scoped_lock kLock(mutex_);
+  return size_;
+}
+
+std::size_t TickerRegistry::BytesUsed() const {
+  const std::scoped_lock kLock(mutex_);
+  const std::size_t kChunks = (size_ + kChunkSize - 1) / kChunkSize;
+  return (kMaxChunks * sizeof(std::atomic<Ticker*>)) +
+         (kChunks * kChunkSize * sizeof(Ticker)) +
+         (ids_.capacity() * (sizeof(std::pair<const Key, TickerId>) + 1)) +
+         string_bytes_;
+}
@@ -0,0 +1,69 @@
+#ifndef GOF23_TICKER_REGISTRY_H
+#define GOF23_TICKER_REGISTRY_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/status/statusor.h>
+#include <absl/strings/string_view.h>
+
+#include "composite.h"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+// Interns Tickers so that each distinct (symbol, name) pair is stored once
+// and a Stock holds only its 32-bit TickerId. Ids are dense, starting at 0,
+// and stay valid for the registry's lifetime; a Ticker reference from
+// Resolve never moves.
+//
+// Intern takes a lock. Resolve does not: tickers live in fixed-size chunks
+// that are never reallocated, found through an array of chunk pointers, so
+// an id already handed out can be resolved while others are being added.
+class TickerRegistry {
+ public:
+  // The registry Stock::Create interns into.
+  static TickerRegistry& Global();
+
+  TickerRegistry();
+  ~TickerRegistry();
+
+  TickerRegistry(const TickerRegistry&) = delete;
+  TickerRegistry& operator=(const TickerRegistry&) = delete;
+
+  // Id of kTicker's (symbol, name) pair, copying it in the first time it
+  // is seen. ResourceExhausted once every id is in use.
+  absl::StatusOr<TickerId> Intern(const Ticker& kTicker);
+
+  // kId must have come from this registry's Intern.
+  [[nodiscard]] const Ticker& Resolve(TickerId kId) const {
+    return chunks_[kId >> kChunkBits].load(std::memory_order_acquire)
+        [kId & (kChunkSize - 1)];
+  }
+
+  [[nodiscard]] std::size_t Size() const;
+
+  // Approximate memory held: the chunks, the index and any string text
+  // too long to be stored inline.
+  [[nodiscard]] std::size_t BytesUsed() const;
+
+ private:
+  static constexpr unsigned kChunkBits = 12;
+  static constexpr std::size_t kChunkSize = std::size_t{1} << kChunkBits;
+  static constexpr std::size_t kMaxChunks = std::size_t{1} << 12;
+
+  using Key = std::pair<absl::string_view, absl::string_view>;
+
+  mutable std::mutex mutex_;
+  std::unique_ptr<std::atomic<Ticker*>[]> chunks_;
+  absl::flat_hash_map<Key, TickerId> ids_;  // views into the chunks
+  std::size_t size_ = 0;
+  std::size_t string_bytes_ = 0;  // heap text beyond the inline buffers
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_TICKER_REGISTRY_H
@@ -0,0 +1,55 @@
+#include "tree_writer.h"
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <absl/status/status.h>
+
+TreeWriter::TreeWriter(const Options options) : options_(options) {}
+
+template <class Flush>
+void TreeWriter::Walk(const RiskNode& kRoot, std::string& buffer,
+                      Flush flush) const {
+  std::vector<std::pair<const RiskNode*, std::size_t>> pending{{&kRoot, 0}};
+  while (!pending.empty()) {
+    const auto [kNode, kDepth] = pending.back();
+    pending.pop_back();
+    buffer.append(kDepth * options_.indent_, ' ');
+    if (const Portfolio* portfolio = AsPortfolio(*kNode)) {
+      buffer += "Portfolio:\n";
+      const auto& kChildren = portfolio->Children();
+      for (auto it = kChildren.rbegin(); it != kChildren.rend(); ++it) {
+        pending.emplace_back(it->get(), kDepth + 1);
+      }
+    } else {
+      kNode->AppendTo(buffer);
+      buffer += '\n';
+    }
+    flush(buffer);
+  }
+}
+
+void TreeWriter::Append(const RiskNode& kRoot, std::string& out) const {
+  Walk(kRoot, out, [](const std::string& /*buffer*/) {});
+}
+
+absl::Status TreeWriter::Write(const RiskNode& kRoot, std::ostream& sink) {
+  buffer_.clear();
+  buffer_.reserve(options_.flush_bytes_);
+  const auto kFlush = [&](std::string& buffer) {
+    if (buffer.size() < options_.flush_bytes_) return;
+    // Once the sink has failed the rest is dropped, not buffered.
+    if (sink) {
+      sink.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+    buffer.clear();
+  };
+  Walk(kRoot, buffer_, kFlush);
+  sink.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+  sink.flush();
+  if (!sink) return absl::DataLossError("write to sink failed");
+  return absl::OkStatus();
+}
@@ -0,0 +1,51 @@
+#ifndef GOF23_TREE_WRITER_H
+#define GOF23_TREE_WRITER_H
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+#include <absl/status/status.h>
+
+#include "composite.h"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+// Dumps a RiskNode tree one line per node, indented by depth:
+//
+//   Portfolio:
+//     Apple (AAPL) @ $100.0000 x 50
+//     Portfolio:
+//       ...
+//
+// Nodes are appended straight into one buffer with RiskNode::AppendTo, so
+// there is no temporary string per node, and the tree is walked with an
+// explicit stack, so depth costs no call stack.
+class TreeWriter {
+ public:
+  struct Options {
+    std::size_t indent_ = 2;             // spaces per level
+    std::size_t flush_bytes_ = 1 << 16;  // Write's buffer size
+  };
+
+  TreeWriter() = default;
+  explicit TreeWriter(Options options);
+
+  // Appends the dump of kRoot to out, which callers can clear and reuse.
+  void Append(const RiskNode& kRoot, std::string& out) const;
+
+  // Streams the dump to sink through a buffer of about flush_bytes_ that
+  // is kept between calls.
+  absl::Status Write(const RiskNode& kRoot, std::ostream& sink);
+
+ private:
+  template <class Flush>
+  void Walk(const RiskNode& kRoot, std::string& buffer, Flush flush) const;
+
+  Options options_;
+  std::string buffer_;
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_TREE_WRITER_H
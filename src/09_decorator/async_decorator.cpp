@@ -0,0 +1,144 @@
+#include "async_decorator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <thread>
+#include <utility>
+
+namespace {
+
+// Empty polls, each with a yield, before the consumer goes to sleep: a
+// burst that is still arriving is picked up without a futex round trip.
+constexpr unsigned kConsumerPolls = 64;
+
+// Full polls between yields under Policy::kSpin, so a spinning producer
+// still lets a consumer on the same core run.
+constexpr unsigned kSpinsPerYield = 64;
+
+}  // namespace
+
+AsyncOrderService::AsyncOrderService(std::unique_ptr<IOrderService> inner)
+    : AsyncOrderService(std::move(inner), Options{}) {}
+
+AsyncOrderService::AsyncOrderService(std::unique_ptr<IOrderService> inner,
+                                     Options options)
+    : OrderServiceDecorator(std::move(inner)),
+      options_(options),
+      ring_(options.capacity_),
+      consumer_([this] { ConsumerLoop(); }) {}
+
+AsyncOrderService::~AsyncOrderService() {
+  Drain();
+  stop_.store(true, std::memory_order_release);
+  wake_.fetch_add(1, std::memory_order_release);
+  wake_.notify_one();
+}
+
+void AsyncOrderService::Execute(const Order& order) {
+  if (Enqueue(order)) Wake();
+}
+
+void AsyncOrderService::ExecuteBatch(const std::span<const Order> orders) {
+  bool sent = false;
+  for (const Order& order : orders) sent |= Enqueue(order);
+  if (sent) Wake();
+}
+
+bool AsyncOrderService::Enqueue(const Order& order) {
+  if (!ring_.TryPush(order)) {
+    switch (options_.policy_) {
+      case Policy::kDrop:
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      case Policy::kSpin:
+        Wake();
+        for (unsigned spins = 1; !ring_.TryPush(order); ++spins) {
+          if (spins % kSpinsPerYield == 0) std::this_thread::yield();
+        }
+        break;
+      case Policy::kBlock:
+        while (true) {
+          const std::uint64_t kExecuted =
+              executed_.load(std::memory_order_acquire);
+          if (ring_.TryPush(order)) break;
+          Wake();
+          WaitForConsumer(kExecuted);
+        }
+        break;
+    }
+  }
+  ++sent_;
+  return true;
+}
+
+// The fence pairs with the consumer's between announcing it is asleep and
+// its last look at the ring: either it sees the new order, or this sees
+// it asleep.
+void AsyncOrderService::Wake() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (consumer_asleep_.load(std::memory_order_relaxed)) {
+    wake_.fetch_add(1, std::memory_order_release);
+    wake_.notify_one();
+  }
+}
+
+void AsyncOrderService::WaitForConsumer(const std::uint64_t kExecuted) {
+  producer_waiting_.store(true, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  executed_.wait(kExecuted, std::memory_order_acquire);
+  producer_waiting_.store(false, std::memory_order_relaxed);
+}
+
+void AsyncOrderService::Drain() {
+  Wake();
+  for (std::uint64_t executed = executed_.load(std::memory_order_acquire);
+       executed != sent_;
+       executed = executed_.load(std::memory_order_acquire)) {
+    WaitForConsumer(executed);
+  }
+}
+
+void AsyncOrderService::ConsumerLoop() {
+  const std::size_t kMaxBatch = std::max<std::size_t>(options_.max_batch_, 1);
+  unsigned idle = 0;
+  while (true) {
+    const std::span<const Order> kRun = ring_.Front(kMaxBatch);
+    if (!kRun.empty()) {
+      if (kRun.size() == 1) {
+        Inner().Execute(kRun.front());
+      } else {
+        Inner().ExecuteBatch(kRun);
+      }
+      ring_.Pop(kRun.size());
+      executed_.fetch_add(kRun.size(), std::memory_order_release);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (producer_waiting_.load(std::memory_order_relaxed)) {
+        executed_.notify_one();
+      }
+      idle = 0;
+      continue;
+    }
+
+    if (stop_.load(std::memory_order_acquire)) {
+      if (ring_.Empty()) return;
+      continue;
+    }
+    if (++idle < kConsumerPolls) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    const std::uint32_t kWake = wake_.load(std::memory_order_acquire);
+    consumer_asleep_.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (ring_.Empty() && !stop_.load(std::memory_order_relaxed)) {
+      wake_.wait(kWake, std::memory_order_acquire);
+    }
+    consumer_asleep_.store(false, std::memory_order_relaxed);
+    idle = 0;
+  }
+}
@@ -0,0 +1,93 @@
+#ifndef GOF23_ASYNC_DECORATOR_H
+#define GOF23_ASYNC_DECORATOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <thread>
+
+#include "../helpers/SpscRing.h"
+#include "decorator.h"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+// Moves the inner service off the caller's thread. Execute copies the
+// order into an SpscRing and returns; a consumer thread of the decorator's
+// own takes whatever has queued up and hands it to the inner service, as
+// one ExecuteBatch per contiguous run read straight from the ring, or
+// order by order when max_batch_ is 1. A run's slots are freed once the
+// inner service returns from it.
+//
+// Only one producer thread may call Execute or ExecuteBatch at a time.
+// The inner service runs on the decorator's consumer thread, never on the
+// caller's: orders reach it in the order they were sent, but later.
+// Drain() waits for them to catch up, and destroying the decorator drains
+// it first.
+//
+// When the ring is full, policy_ decides: kBlock sleeps the caller until
+// the consumer frees slots, kSpin busy-waits for them (lowest latency if
+// the caller has a core to burn), and kDrop discards the order and counts
+// it in Dropped().
+class AsyncOrderService final : public OrderServiceDecorator {
+ public:
+  enum class Policy { kBlock, kSpin, kDrop };
+
+  struct Options {
+    std::size_t capacity_ = 4096;  // orders; rounded up to a power of two
+    std::size_t max_batch_ = 256;
+    Policy policy_ = Policy::kBlock;
+  };
+
+  explicit AsyncOrderService(std::unique_ptr<IOrderService> inner);
+  AsyncOrderService(std::unique_ptr<IOrderService> inner, Options options);
+  ~AsyncOrderService() override;
+
+  AsyncOrderService(const AsyncOrderService&) = delete;
+  AsyncOrderService& operator=(const AsyncOrderService&) = delete;
+
+  void Execute(const Order& order) override;
+  void ExecuteBatch(std::span<const Order> orders) override;
+
+  // Returns once every order sent so far has been through the inner
+  // service.
+  void Drain();
+
+  [[nodiscard]] std::size_t Dropped() const {
+    return dropped_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  // Copies the order in, applying the policy if the ring is full. True
+  // if it went in.
+  bool Enqueue(const Order& order);
+
+  // Wakes the consumer if it has gone to sleep on an empty ring.
+  void Wake();
+
+  // Sleeps the caller until the consumer next finishes a run.
+  void WaitForConsumer(std::uint64_t executed);
+
+  void ConsumerLoop();
+
+  Options options_;
+  SpscRing<Order> ring_;
+  std::uint64_t sent_ = 0;  // producer side only
+  std::atomic<std::size_t> dropped_{0};
+
+  // Orders through the inner service; the producer sleeps on it.
+  alignas(64) std::atomic<std::uint64_t> executed_{0};
+  std::atomic<bool> producer_waiting_{false};
+
+  // Bumped to wake the consumer, which sleeps on it.
+  alignas(64) std::atomic<std::uint32_t> wake_{0};
+  std::atomic<bool> consumer_asleep_{false};
+  std::atomic<bool> stop_{false};
+
+  std::jthread consumer_;  // last: joined before the rest goes
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_ASYNC_DECORATOR_H
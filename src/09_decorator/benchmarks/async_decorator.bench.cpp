@@ -0,0 +1,106 @@
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <streambuf>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "async_decorator.h"
+#include "decorator.h"
+
+namespace {
+
+// Swallows std::cout for the life of a benchmark, so the exchange's cost
+// is formatting, not the console.
+class DiscardStdout {
+ public:
+  DiscardStdout() : saved_(std::cout.rdbuf(&null_)) {}
+  ~DiscardStdout() { std::cout.rdbuf(saved_); }
+
+  DiscardStdout(const DiscardStdout&) = delete;
+  DiscardStdout& operator=(const DiscardStdout&) = delete;
+
+ private:
+  struct Null final : std::streambuf {
+    std::streamsize xsputn(const char* /*s*/, std::streamsize n) override {
+      return n;
+    }
+    int overflow(int c) override { return c; }
+  };
+  Null null_;
+  std::streambuf* saved_;
+};
+
+std::vector<Order> MakeOrders(const std::size_t kCount) {
+  std::vector<Order> orders(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    orders[i] = {.symbol_ = {"AAPL"},
+                 .price_ = static_cast<std::int64_t>(2684700 + i),
+                 .quantity_ = static_cast<std::int64_t>(1 + (i % 100))};
+  }
+  return orders;
+}
+
+void SetOrdersPerSecond(benchmark::State& state, const std::size_t kOrders) {
+  state.counters["orders/s"] =
+      benchmark::Counter(static_cast<double>(kOrders),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// What the strategy thread pays today: formatting and the write, inline.
+void BM_SyncExchange(benchmark::State& state) {
+  const DiscardStdout kDiscard;
+  const std::vector<Order> kOrders = MakeOrders(64);
+  ExchangeOrderService service;
+  for (auto _ : state) {
+    for (const Order& kOrder : kOrders) service.Execute(kOrder);
+  }
+  SetOrdersPerSecond(state, kOrders.size());
+}
+
+// What it pays with the exchange behind the ring, while there is room:
+// the ring is drained, untimed, before it can fill.
+void BM_AsyncEnqueue(benchmark::State& state) {
+  const DiscardStdout kDiscard;
+  const std::vector<Order> kOrders = MakeOrders(64);
+  AsyncOrderService service(std::make_unique<ExchangeOrderService>(),
+                            {.capacity_ = 1 << 16});
+  for (auto _ : state) {
+    for (const Order& kOrder : kOrders) service.Execute(kOrder);
+    if (state.iterations() % 512 == 0) {
+      state.PauseTiming();
+      service.Drain();
+      state.ResumeTiming();
+    }
+  }
+  service.Drain();
+  SetOrdersPerSecond(state, kOrders.size());
+}
+
+// A producer outrunning the consumer through a small ring, so the policy
+// decides what a send costs.
+void BM_AsyncSaturated(benchmark::State& state) {
+  const DiscardStdout kDiscard;
+  const std::vector<Order> kOrders = MakeOrders(64);
+  AsyncOrderService service(
+      std::make_unique<ExchangeOrderService>(),
+      {.capacity_ = 1024,
+       .policy_ = static_cast<AsyncOrderService::Policy>(state.range(0))});
+  for (auto _ : state) {
+    for (const Order& kOrder : kOrders) service.Execute(kOrder);
+  }
+  service.Drain();
+  state.counters["dropped"] = benchmark::Counter(
+      static_cast<double>(service.Dropped()) /
+      static_cast<double>(state.iterations() * kOrders.size()));
+  SetOrdersPerSecond(state, kOrders.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_SyncExchange);
+BENCHMARK(BM_AsyncEnqueue);
+// 0 kBlock, 1 kSpin, 2 kDrop
+BENCHMARK(BM_AsyncSaturated)->Arg(0)->Arg(1)->Arg(2)->ArgName("policy");
@@ -0,0 +1,105 @@
+#include "decorator_stack.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "decorator.h"
+
+namespace {
+
+constexpr std::size_t kOrders = 1024;
+
+// Light enough that the per-layer mechanism, not the layer's own work,
+// dominates: each layer adds the order's quantity to its own total.
+class Tally {
+ public:
+  template <class Next>
+  void Execute(const Order& kOrder, Next&& next) {
+    total_ += kOrder.quantity_;
+    std::forward<Next>(next)(kOrder);
+  }
+
+ private:
+  std::int64_t total_ = 0;
+};
+
+class TallyDecorator final : public OrderServiceDecorator {
+ public:
+  using OrderServiceDecorator::OrderServiceDecorator;
+
+  void Execute(const Order& order) override {
+    total_ += order.quantity_;
+    Inner().Execute(order);
+  }
+
+ private:
+  std::int64_t total_ = 0;
+};
+
+class Sink final : public IOrderService {
+ public:
+  void Execute(const Order& order) override {
+    notional_ += order.price_ * order.quantity_;
+  }
+
+  [[nodiscard]] std::int64_t Notional() const { return notional_; }
+
+ private:
+  std::int64_t notional_ = 0;
+};
+
+std::vector<Order> MakeOrders() {
+  std::vector<Order> orders(kOrders);
+  for (std::size_t i = 0; i < kOrders; ++i) {
+    orders[i] = {.symbol_ = {"AAPL"},
+                 .price_ = static_cast<std::int64_t>(2684700 + i),
+                 .quantity_ = static_cast<std::int64_t>(1 + (i % 100))};
+  }
+  return orders;
+}
+
+void SetOrdersPerSecond(benchmark::State& state) {
+  state.counters["orders/s"] =
+      benchmark::Counter(static_cast<double>(kOrders),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_RuntimeChain(benchmark::State& state) {
+  auto sink = std::make_unique<Sink>();
+  const Sink& kSink = *sink;
+  std::unique_ptr<IOrderService> service = std::move(sink);
+  for (int64_t layer = 0; layer < state.range(0); ++layer) {
+    service = std::make_unique<TallyDecorator>(std::move(service));
+  }
+  const std::vector<Order> kOrderList = MakeOrders();
+  for (auto _ : state) {
+    for (const Order& kOrder : kOrderList) service->Execute(kOrder);
+    benchmark::DoNotOptimize(kSink.Notional());
+  }
+  SetOrdersPerSecond(state);
+}
+
+template <class... Layers>
+void BM_StaticStack(benchmark::State& state) {
+  Stack<Layers..., Sink> stack;
+  const std::vector<Order> kOrderList = MakeOrders();
+  for (auto _ : state) {
+    for (const Order& kOrder : kOrderList) stack.Execute(kOrder);
+    benchmark::DoNotOptimize(stack.template Layer<sizeof...(Layers)>());
+  }
+  SetOrdersPerSecond(state);
+}
+
+}  // namespace
+
+BENCHMARK(BM_RuntimeChain)->Arg(1)->Arg(3)->Arg(6)->ArgName("layers");
+BENCHMARK(BM_StaticStack<Tally>)->Name("BM_StaticStack/layers:1");
+BENCHMARK(BM_StaticStack<Tally, Tally, Tally>)
+    ->Name("BM_StaticStack/layers:3");
+BENCHMARK(BM_StaticStack<Tally, Tally, Tally, Tally, Tally, Tally>)
+    ->Name("BM_StaticStack/layers:6");
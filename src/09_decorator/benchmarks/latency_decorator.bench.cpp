@@ -0,0 +1,78 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "../helpers/LatencyHistogram.h"
+#include "decorator.h"
+#include "latency_decorator.h"
+
+namespace {
+
+// Stands in for a fast venue, so the decorator's own cost shows.
+class SinkService final : public IOrderService {
+ public:
+  void Execute(const Order& order) override {
+    benchmark::DoNotOptimize(order.quantity_);
+  }
+};
+
+std::vector<Order> MakeOrders(const std::size_t kCount,
+                              const std::size_t kSymbols) {
+  std::vector<Order> orders(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    Order& order = orders[i];
+    const std::size_t kSymbol = i % kSymbols;
+    order.symbol_ = {'S', static_cast<char>('A' + (kSymbol % 26)),
+                     static_cast<char>('A' + (kSymbol / 26 % 26))};
+    order.price_ = static_cast<std::int64_t>(2684700 + i);
+    order.quantity_ = static_cast<std::int64_t>(1 + (i % 100));
+  }
+  return orders;
+}
+
+void SetOrdersPerSecond(benchmark::State& state, const std::size_t kOrders) {
+  state.counters["orders/s"] =
+      benchmark::Counter(static_cast<double>(kOrders),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_UntimedSink(benchmark::State& state) {
+  const std::vector<Order> kOrders = MakeOrders(1024, 64);
+  const std::unique_ptr<IOrderService> kService =
+      std::make_unique<SinkService>();
+  for (auto _ : state) {
+    for (const Order& kOrder : kOrders) kService->Execute(kOrder);
+  }
+  SetOrdersPerSecond(state, kOrders.size());
+}
+
+void BM_TimedSink(benchmark::State& state) {
+  const std::vector<Order> kOrders =
+      MakeOrders(1024, static_cast<std::size_t>(state.range(0)));
+  const std::unique_ptr<IOrderService> kService =
+      std::make_unique<LatencyDecoratorService>(
+          std::make_unique<SinkService>());
+  for (auto _ : state) {
+    for (const Order& kOrder : kOrders) kService->Execute(kOrder);
+  }
+  SetOrdersPerSecond(state, kOrders.size());
+}
+
+void BM_HistogramRecord(benchmark::State& state) {
+  LatencyHistogram histogram;
+  std::uint64_t value = 1;
+  for (auto _ : state) {
+    histogram.Record(value);
+    value = (value * 75) % 65537;  // wanders over about 16 buckets' worth
+  }
+  benchmark::DoNotOptimize(histogram.Count());
+}
+
+}  // namespace
+
+BENCHMARK(BM_UntimedSink);
+BENCHMARK(BM_TimedSink)->Arg(1)->Arg(64)->Arg(676)->ArgName("symbols");
+BENCHMARK(BM_HistogramRecord);
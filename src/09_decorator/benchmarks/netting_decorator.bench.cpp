@@ -0,0 +1,96 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "decorator.h"
+#include "netting_decorator.h"
+
+namespace {
+
+// Counts what reaches it.
+class SinkService final : public IOrderService {
+ public:
+  explicit SinkService(std::size_t& orders) : orders_(orders) {}
+  void Execute(const Order& /*order*/) override { ++orders_; }
+
+ private:
+  std::size_t& orders_;
+};
+
+// Buys and sells of 1-100 spread over kSymbols names, as a strategy
+// re-quoting a small universe sends them.
+std::vector<Order> MakeFlow(const std::size_t kCount,
+                            const std::size_t kSymbols) {
+  std::mt19937_64 rng(17);
+  std::uniform_int_distribution<std::int64_t> quantity(-100, 100);
+  std::vector<Order> orders(kCount);
+  for (Order& order : orders) {
+    const auto kSymbol = static_cast<char>(rng() % kSymbols);
+    order.symbol_ = {'S', static_cast<char>('A' + kSymbol)};
+    order.price_ = 2684700;
+    order.quantity_ = quantity(rng);
+  }
+  return orders;
+}
+
+void Report(benchmark::State& state, const std::size_t kSent,
+            const std::size_t kReceived) {
+  state.counters["orders/s"] =
+      benchmark::Counter(static_cast<double>(kSent),
+                         benchmark::Counter::kIsIterationInvariantRate);
+  state.counters["sent_downstream"] = benchmark::Counter(
+      static_cast<double>(kReceived) /
+      static_cast<double>(kSent * state.iterations()));
+}
+
+void BM_PassThrough(benchmark::State& state) {
+  const std::vector<Order> kFlow = MakeFlow(4096, 16);
+  std::size_t received = 0;
+  const std::unique_ptr<IOrderService> kService =
+      std::make_unique<SinkService>(received);
+  for (auto _ : state) {
+    for (const Order& kOrder : kFlow) kService->Execute(kOrder);
+  }
+  Report(state, kFlow.size(), received);
+}
+
+// Windows long enough that only the order limit closes them, so the
+// downstream rate depends on max_orders_ rather than on machine speed.
+void BM_Netted(benchmark::State& state) {
+  const std::vector<Order> kFlow = MakeFlow(4096, 16);
+  std::size_t received = 0;
+  auto service = std::make_unique<NettingDecoratorService>(
+      std::make_unique<SinkService>(received),
+      NettingDecoratorService::Options{
+          .window_ = std::chrono::hours(1),
+          .max_orders_ = static_cast<std::size_t>(state.range(0))});
+  for (auto _ : state) {
+    for (const Order& kOrder : kFlow) service->Execute(kOrder);
+  }
+  service.reset();  // flushes
+  Report(state, kFlow.size(), received);
+}
+
+// The same flow through the real clock, with a 50us window.
+void BM_NettedTimed(benchmark::State& state) {
+  const std::vector<Order> kFlow = MakeFlow(4096, 16);
+  std::size_t received = 0;
+  auto service = std::make_unique<NettingDecoratorService>(
+      std::make_unique<SinkService>(received));
+  for (auto _ : state) {
+    for (const Order& kOrder : kFlow) service->Execute(kOrder);
+  }
+  service.reset();
+  Report(state, kFlow.size(), received);
+}
+
+}  // namespace
+
+BENCHMARK(BM_PassThrough);
+BENCHMARK(BM_Netted)->Arg(4)->Arg(16)->Arg(64)->ArgName("max_orders");
+BENCHMARK(BM_NettedTimed);
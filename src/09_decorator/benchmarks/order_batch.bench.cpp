@@ -0,0 +1,82 @@
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <span>
+#include <streambuf>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "decorator.h"
+
+namespace {
+
+// Swallows std::cout for the life of a benchmark, so the terminal's cost
+// is formatting, not the console.
+class DiscardStdout {
+ public:
+  DiscardStdout() : saved_(std::cout.rdbuf(&null_)) {}
+  ~DiscardStdout() { std::cout.rdbuf(saved_); }
+
+  DiscardStdout(const DiscardStdout&) = delete;
+  DiscardStdout& operator=(const DiscardStdout&) = delete;
+
+ private:
+  struct Null final : std::streambuf {
+    std::streamsize xsputn(const char* /*s*/, std::streamsize n) override {
+      return n;
+    }
+    int overflow(int c) override { return c; }
+  };
+  Null null_;
+  std::streambuf* saved_;
+};
+
+std::vector<Order> MakeOrders(const std::size_t kCount) {
+  std::vector<Order> orders(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    orders[i] = {.symbol_ = {"AAPL"},
+                 .price_ = static_cast<std::int64_t>(2684700 + i),
+                 .quantity_ = static_cast<std::int64_t>(1 + (i % 100))};
+  }
+  return orders;
+}
+
+// Logging over a risk check over the exchange.
+std::unique_ptr<IOrderService> MakeChain() {
+  return std::make_unique<LoggingDecoratorService>(
+      std::make_unique<RiskCheckDecoratorService>(
+          std::make_unique<ExchangeOrderService>()));
+}
+
+void SetOrdersPerSecond(benchmark::State& state, const std::size_t kOrders) {
+  state.counters["orders/s"] =
+      benchmark::Counter(static_cast<double>(kOrders),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_ExecuteEach(benchmark::State& state) {
+  const DiscardStdout kDiscard;
+  const auto kBurst = static_cast<std::size_t>(state.range(0));
+  const std::vector<Order> kOrders = MakeOrders(kBurst);
+  const auto kChain = MakeChain();
+  for (auto _ : state) {
+    for (const Order& kOrder : kOrders) kChain->Execute(kOrder);
+  }
+  SetOrdersPerSecond(state, kBurst);
+}
+
+void BM_ExecuteBatch(benchmark::State& state) {
+  const DiscardStdout kDiscard;
+  const auto kBurst = static_cast<std::size_t>(state.range(0));
+  const std::vector<Order> kOrders = MakeOrders(kBurst);
+  const auto kChain = MakeChain();
+  for (auto _ : state) kChain->ExecuteBatch(kOrders);
+  SetOrdersPerSecond(state, kBurst);
+}
+
+}  // namespace
+
+BENCHMARK(BM_ExecuteEach)->Arg(16)->Arg(256)->ArgName("burst");
+BENCHMARK(BM_ExecuteBatch)->Arg(16)->Arg(256)->ArgName("burst");
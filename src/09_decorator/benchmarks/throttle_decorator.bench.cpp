@@ -0,0 +1,83 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "decorator.h"
+#include "throttle_decorator.h"
+
+namespace {
+
+class SinkService final : public IOrderService {
+ public:
+  void Execute(const Order& order) override {
+    benchmark::DoNotOptimize(order.quantity_);
+  }
+};
+
+// Budgets far above what a benchmark can send, so every check passes and
+// the bucket CASes are what is measured.
+std::unique_ptr<ThrottleDecoratorService> MakeThrottle() {
+  return std::make_unique<ThrottleDecoratorService>(
+      std::make_unique<SinkService>(),
+      ThrottleDecoratorService::Options{.orders_per_second_ = 1e9,
+                                        .burst_ = 1e6,
+                                        .symbol_orders_per_second_ = 1e9,
+                                        .symbol_burst_ = 1e6});
+}
+
+// Shared by every thread of a run; set up and torn down by thread 0.
+std::unique_ptr<ThrottleDecoratorService> shared_throttle;
+
+std::int64_t Now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// Every thread on one symbol, so all of them fight over both buckets;
+// with arg 1 each thread has a symbol of its own and only the global
+// bucket is shared. The clock is read once per 64 checks, as a caller
+// stamping a burst would.
+void BM_AdmitContended(benchmark::State& state) {
+  if (state.thread_index() == 0) shared_throttle = MakeThrottle();
+  const bool kOwnSymbol = state.range(0) != 0;
+  const Symbol kSymbol{'S',
+                       static_cast<char>(
+                           'A' + (kOwnSymbol ? state.thread_index() : 0))};
+  std::size_t admitted = 0;
+  for (auto _ : state) {
+    const std::int64_t kNow = Now();
+    for (int i = 0; i < 64; ++i) {
+      admitted += static_cast<std::size_t>(
+          shared_throttle->Admit(kSymbol, kNow));
+    }
+  }
+  benchmark::DoNotOptimize(admitted);
+  state.counters["checks/s"] = benchmark::Counter(
+      64, benchmark::Counter::kIsIterationInvariantRate);
+  if (state.thread_index() == 0) shared_throttle.reset();
+}
+
+// Execute end to end, clock read included.
+void BM_ThrottledExecute(benchmark::State& state) {
+  const auto kThrottle = MakeThrottle();
+  const Order kOrder{.symbol_ = {"AAPL"}, .price_ = 1, .quantity_ = 1};
+  for (auto _ : state) kThrottle->Execute(kOrder);
+  state.counters["orders/s"] = benchmark::Counter(
+      1, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+}  // namespace
+
+BENCHMARK(BM_AdmitContended)
+    ->Arg(0)
+    ->Arg(1)
+    ->ArgName("own_symbol")
+    ->Threads(1)
+    ->Threads(2)
+    ->Threads(4)
+    ->UseRealTime();
+BENCHMARK(BM_ThrottledExecute);
@@ -4,20 +4,80 @@
 
 #include "decorator.h"
 
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
 #include <format>
 #include <iostream>
+#include <iterator>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
 
 #include <absl/strings/str_format.h>
 
+namespace {
+
+// Same text as std::format("[ORDER] {: <5}: ${:.4f} x {}\n") over the
+// price in dollars, but price_ is already fixed point with four decimals, so
+// its digits are written straight from the integer with std::to_chars. The
+// format machinery cost several times the rest of a batch.
+void AppendOrder(std::string& out, const Order& kOrder) {
+  static_assert(kPriceMultiplier == 10000, "four decimal places");
+  constexpr std::size_t kSymbolWidth = 5;
+  char number[24];
+
+  const std::string_view kSymbol(
+      kOrder.symbol_.data(),
+      std::ranges::find(kOrder.symbol_, '\0') - kOrder.symbol_.begin());
+  out += "[ORDER] ";
+  out += kSymbol;
+  if (kSymbol.size() < kSymbolWidth) {
+    out.append(kSymbolWidth - kSymbol.size(), ' ');
+  }
+  out += ": $";
+
+  if (kOrder.price_ < 0) out += '-';
+  const std::uint64_t kMagnitude =
+      kOrder.price_ < 0 ? -static_cast<std::uint64_t>(kOrder.price_)
+                        : static_cast<std::uint64_t>(kOrder.price_);
+  out.append(number,
+             std::to_chars(number, std::end(number),
+                           kMagnitude / kPriceMultiplier)
+                 .ptr);
+  auto fraction = static_cast<unsigned>(kMagnitude % kPriceMultiplier);
+  char decimals[5] = {'.'};
+  for (std::size_t digit = 4; digit > 0; --digit, fraction /= 10) {
+    decimals[digit] = static_cast<char>('0' + (fraction % 10));
+  }
+  out.append(decimals, sizeof(decimals));
+
+  out += " x ";
+  out.append(number,
+             std::to_chars(number, std::end(number), kOrder.quantity_).ptr);
+  out += '\n';
+}
+
+}  // namespace
+
 IOrderService::~IOrderService() = default;
 
+void IOrderService::ExecuteBatch(const std::span<const Order> orders) {
+  for (const Order& order : orders) Execute(order);
+}
+
 void ExchangeOrderService::Execute(const Order& order) {
-  const double kPriceDouble =
-      static_cast<double>(order.price_) / kPriceMultiplier;
+  buffer_.clear();
+  AppendOrder(buffer_, order);
+  std::cout << buffer_;
+}
 
-  std::cout << std::format("[ORDER] {: <5}: ${:.4f} x {}\n",
-                           std::string_view(order.symbol_.data()), kPriceDouble,
-                           order.quantity_);
+void ExchangeOrderService::ExecuteBatch(const std::span<const Order> orders) {
+  buffer_.clear();
+  for (const Order& order : orders) AppendOrder(buffer_, order);
+  std::cout << buffer_;
 }
 
 OrderServiceDecorator::OrderServiceDecorator(
@@ -31,3 +91,71 @@ void LoggingDecoratorService::Execute(const Order& order) {
   Inner().Execute(order);
   std::cout << "[LOG  ] Completed order\n";
 }
+
+void LoggingDecoratorService::ExecuteBatch(
+    const std::span<const Order> orders) {
+  std::cout << std::format("[LOG  ] Placing {} orders\n", orders.size());
+  Inner().ExecuteBatch(orders);
+  std::cout << std::format("[LOG  ] Completed {} orders\n", orders.size());
+}
+
+RiskCheckDecoratorService::RiskCheckDecoratorService(
+    std::unique_ptr<IOrderService> inner)
+    : RiskCheckDecoratorService(std::move(inner), Options{}) {}
+
+RiskCheckDecoratorService::RiskCheckDecoratorService(
+    std::unique_ptr<IOrderService> inner, Options options)
+    : OrderServiceDecorator(std::move(inner)), options_(options) {}
+
+// Written with & rather than && so it has no branches to mispredict and
+// the batch loop over it can be vectorized.
+bool RiskCheckDecoratorService::Passes(const Order& order) const {
+  // Sells are negative, so the limits apply to the size. It is negated
+  // unsigned, which is defined even for INT64_MIN.
+  const std::uint64_t kSize =
+      order.quantity_ < 0 ? 0 - static_cast<std::uint64_t>(order.quantity_)
+                          : static_cast<std::uint64_t>(order.quantity_);
+  const double kNotional =
+      static_cast<double>(order.price_) * static_cast<double>(kSize);
+  return static_cast<bool>(
+      static_cast<int>(kSize > 0) &
+      static_cast<int>(kSize <=
+                       static_cast<std::uint64_t>(options_.max_quantity_)) &
+      static_cast<int>(order.price_ > 0) &
+      static_cast<int>(kNotional <= options_.max_notional_ * kPriceMultiplier));
+}
+
+void RiskCheckDecoratorService::Execute(const Order& order) {
+  if (Passes(order)) {
+    Inner().Execute(order);
+    return;
+  }
+  ++rejected_;
+  std::cout << "[CHECK] Rejected order\n";
+}
+
+void RiskCheckDecoratorService::ExecuteBatch(
+    const std::span<const Order> orders) {
+  passes_.resize(orders.size());
+  std::size_t passed = 0;
+  for (std::size_t i = 0; i < orders.size(); ++i) {
+    passes_[i] = static_cast<std::uint8_t>(Passes(orders[i]));
+    passed += passes_[i];
+  }
+  if (passed == orders.size()) {
+    Inner().ExecuteBatch(orders);
+    return;
+  }
+
+  accepted_.clear();
+  for (std::size_t i = 0; i < orders.size(); ++i) {
+    if (passes_[i] != 0) accepted_.push_back(orders[i]);
+  }
+  const std::size_t kRejected = orders.size() - passed;
+  rejected_ += kRejected;
+  std::cout << std::format("[CHECK] Rejected {} of {} orders\n", kRejected,
+                           orders.size());
+  if (!accepted_.empty()) Inner().ExecuteBatch(accepted_);
+}
+
+std::size_t RiskCheckDecoratorService::Rejected() const { return rejected_; }
@@ -7,8 +7,11 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
+#include <vector>
 
 constexpr int64_t kPriceMultiplier = 10000;
 constexpr std::size_t kMaxSymbolLength = 6;
@@ -18,18 +21,29 @@ using Symbol = std::array<char, kMaxSymbolLength>;
 struct Order {
   Symbol symbol_{};
   std::int64_t price_{};
-  std::int64_t quantity_{};
+  std::int64_t quantity_{};  // positive to buy, negative to sell
 };
 
 class IOrderService {
  public:
   virtual ~IOrderService();
   virtual void Execute(const Order& order) = 0;
+
+  // Executes a burst of orders in order. Services override it to pay their
+  // fixed costs once per batch; the default calls Execute per order, so a
+  // decorator without its own batch path still works, one order at a time.
+  virtual void ExecuteBatch(std::span<const Order> orders);
 };
 
 class ExchangeOrderService final : public IOrderService {
  public:
   void Execute(const Order& order) override;
+
+  // Formats the whole batch into one buffer and writes it once.
+  void ExecuteBatch(std::span<const Order> orders) override;
+
+ private:
+  std::string buffer_;
 };
 
 class OrderServiceDecorator : public IOrderService {
@@ -48,6 +62,41 @@ class LoggingDecoratorService final : public OrderServiceDecorator {
   using OrderServiceDecorator::OrderServiceDecorator;
 
   void Execute(const Order& order) override;
+
+  // One pair of log lines per batch rather than per order.
+  void ExecuteBatch(std::span<const Order> orders) override;
+};
+
+// Drops orders that fail basic limits: price must be positive, and the
+// order's size, |quantity_|, between 1 and max_quantity_ with a notional
+// of at most max_notional_ dollars. Buys and sells are held to the same
+// limits.
+class RiskCheckDecoratorService final : public OrderServiceDecorator {
+ public:
+  struct Options {
+    std::int64_t max_quantity_ = 1'000'000;
+    double max_notional_ = 10'000'000.0;
+  };
+
+  explicit RiskCheckDecoratorService(std::unique_ptr<IOrderService> inner);
+  RiskCheckDecoratorService(std::unique_ptr<IOrderService> inner,
+                            Options options);
+
+  void Execute(const Order& order) override;
+
+  // Checks the batch in one branch-free pass, then passes it on whole if
+  // every order passed, or else the passing orders as one compacted block.
+  void ExecuteBatch(std::span<const Order> orders) override;
+
+  [[nodiscard]] std::size_t Rejected() const;
+
+ private:
+  [[nodiscard]] bool Passes(const Order& order) const;
+
+  Options options_;
+  std::vector<std::uint8_t> passes_;  // per order of the current batch
+  std::vector<Order> accepted_;
+  std::size_t rejected_ = 0;
 };
 
 #endif  // GOF23_DECORATOR_H
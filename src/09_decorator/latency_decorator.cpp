@@ -0,0 +1,125 @@
+#include "latency_decorator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <absl/strings/str_cat.h>
+#include <absl/strings/str_format.h>
+
+#include "../helpers/LatencyHistogram.h"
+
+namespace {
+
+// steady_clock is read through the vDSO from the TSC on any modern x86
+// Linux, so it costs about as much as rdtsc would without needing the
+// tick rate calibrated.
+using Clock = std::chrono::steady_clock;
+
+std::uint64_t Elapsed(const Clock::time_point kStart,
+                      const Clock::time_point kEnd) {
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(kEnd - kStart)
+          .count());
+}
+
+void AppendLine(std::string& out, const std::string_view kLabel,
+                const LatencyHistogram& kHistogram) {
+  const LatencyHistogram::Summary kSummary = kHistogram.Summarize();
+  absl::StrAppendFormat(&out,
+                        "%-7s n=%d p50=%dns p99=%dns p99.9=%dns max=%dns\n",
+                        kLabel, kSummary.count_, kSummary.p50_, kSummary.p99_,
+                        kSummary.p999_, kSummary.max_);
+}
+
+}  // namespace
+
+LatencyDecoratorService::LatencyDecoratorService(
+    std::unique_ptr<IOrderService> inner)
+    : LatencyDecoratorService(std::move(inner), Options{}) {}
+
+LatencyDecoratorService::LatencyDecoratorService(
+    std::unique_ptr<IOrderService> inner, Options options)
+    : OrderServiceDecorator(std::move(inner)),
+      symbols_(options.max_symbols_) {}
+
+LatencyDecoratorService::~LatencyDecoratorService() {
+  symbols_.ForEach([](const Symbol& /*symbol*/,
+                      const std::atomic<LatencyHistogram*>& kHistogram) {
+    delete kHistogram.load(std::memory_order_acquire);
+  });
+}
+
+void LatencyDecoratorService::Execute(const Order& order) {
+  const Clock::time_point kStart = Clock::now();
+  Inner().Execute(order);
+  const std::uint64_t kNanos = Elapsed(kStart, Clock::now());
+
+  overall_.Record(kNanos);
+  if (LatencyHistogram* histogram = Histogram(order.symbol_)) {
+    histogram->Record(kNanos);
+  }
+}
+
+void LatencyDecoratorService::ExecuteBatch(
+    const std::span<const Order> orders) {
+  const Clock::time_point kStart = Clock::now();
+  Inner().ExecuteBatch(orders);
+  batches_.Record(Elapsed(kStart, Clock::now()));
+}
+
+LatencyHistogram* LatencyDecoratorService::Histogram(const Symbol& symbol) {
+  std::atomic<LatencyHistogram*>* slot = symbols_.FindOrInsert(symbol);
+  if (slot == nullptr) {
+    untracked_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  LatencyHistogram* histogram = slot->load(std::memory_order_acquire);
+  if (histogram != nullptr) return histogram;
+  // Whoever installs first wins; a racing loser throws its copy away.
+  auto fresh = std::make_unique<LatencyHistogram>();
+  if (slot->compare_exchange_strong(histogram, fresh.get(),
+                                    std::memory_order_acq_rel)) {
+    return fresh.release();
+  }
+  return histogram;
+}
+
+const LatencyHistogram* LatencyDecoratorService::ForSymbol(
+    const Symbol& symbol) const {
+  const std::atomic<LatencyHistogram*>* slot = symbols_.Find(symbol);
+  return slot == nullptr ? nullptr : slot->load(std::memory_order_acquire);
+}
+
+std::string LatencyDecoratorService::Report() const {
+  std::vector<std::pair<std::string, const LatencyHistogram*>> symbols;
+  symbols_.ForEach([&symbols](const Symbol& kSymbol,
+                              const std::atomic<LatencyHistogram*>& kSlot) {
+    const LatencyHistogram* histogram = kSlot.load(std::memory_order_acquire);
+    if (histogram == nullptr) return;  // claimed, not yet recorded into
+    symbols.emplace_back(
+        std::string(kSymbol.data(),
+                    std::ranges::find(kSymbol, '\0') - kSymbol.begin()),
+        histogram);
+  });
+  std::ranges::sort(symbols);
+
+  std::string out;
+  AppendLine(out, "all", overall_);
+  if (batches_.Count() > 0) AppendLine(out, "batches", batches_);
+  for (const auto& [kName, kHistogram] : symbols) {
+    AppendLine(out, kName, *kHistogram);
+  }
+  if (Untracked() > 0) {
+    absl::StrAppend(&out, "untracked n=", Untracked(), "\n");
+  }
+  return out;
+}
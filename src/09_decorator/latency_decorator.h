@@ -0,0 +1,77 @@
+#ifndef GOF23_LATENCY_DECORATOR_H
+#define GOF23_LATENCY_DECORATOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+
+#include "../helpers/LatencyHistogram.h"
+#include "decorator.h"
+#include "symbol_map.h"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+// Times every order through the service it wraps and keeps the latencies
+// in histograms: one over all orders and one per symbol, so a slow name
+// stands out from the aggregate. The clock reads sit directly around
+// Inner().Execute, and everything else (the symbol lookup, the recording)
+// happens after the second read, outside the measured span.
+//
+// Recording takes no locks. Symbols live in a SymbolMap, each with its
+// histogram created on first use, so Report and the accessors can be read
+// from another thread while orders flow. Past max_symbols_ distinct
+// symbols, new ones are still counted in Overall() but get no histogram of
+// their own.
+class LatencyDecoratorService final : public OrderServiceDecorator {
+ public:
+  struct Options {
+    std::size_t max_symbols_ = 1024;
+  };
+
+  explicit LatencyDecoratorService(std::unique_ptr<IOrderService> inner);
+  LatencyDecoratorService(std::unique_ptr<IOrderService> inner,
+                          Options options);
+  ~LatencyDecoratorService() override;
+
+  LatencyDecoratorService(const LatencyDecoratorService&) = delete;
+  LatencyDecoratorService& operator=(const LatencyDecoratorService&) = delete;
+
+  void Execute(const Order& order) override;
+
+  // One timing for the whole batch, recorded in Batches(): the inner
+  // service handles a batch as a unit, so its orders have no latencies of
+  // their own.
+  void ExecuteBatch(std::span<const Order> orders) override;
+
+  [[nodiscard]] const LatencyHistogram& Overall() const { return overall_; }
+  [[nodiscard]] const LatencyHistogram& Batches() const { return batches_; }
+
+  // Null until the symbol has been seen, and for untracked symbols.
+  [[nodiscard]] const LatencyHistogram* ForSymbol(const Symbol& symbol) const;
+
+  // Orders, not symbols, that found no per-symbol histogram to go in.
+  [[nodiscard]] std::uint64_t Untracked() const {
+    return untracked_.load(std::memory_order_relaxed);
+  }
+
+  // p50/p99/p99.9/max in nanoseconds: one line over all orders, one for
+  // batches if there were any, then one per symbol in symbol order.
+  [[nodiscard]] std::string Report() const;
+
+ private:
+  // The symbol's histogram, created on first use; null once the table is
+  // full.
+  LatencyHistogram* Histogram(const Symbol& symbol);
+
+  LatencyHistogram overall_;
+  LatencyHistogram batches_;
+  SymbolMap<std::atomic<LatencyHistogram*>> symbols_;
+  std::atomic<std::uint64_t> untracked_{0};
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_LATENCY_DECORATOR_H
@@ -0,0 +1,94 @@
+#include "netting_decorator.h"
+
+#include <memory>
+#include <span>
+#include <utility>
+
+NettingDecoratorService::NettingDecoratorService(
+    std::unique_ptr<IOrderService> inner)
+    : NettingDecoratorService(std::move(inner), Options{}) {}
+
+NettingDecoratorService::NettingDecoratorService(
+    std::unique_ptr<IOrderService> inner, Options options)
+    : OrderServiceDecorator(std::move(inner)), options_(options) {}
+
+NettingDecoratorService::~NettingDecoratorService() { Flush(); }
+
+void NettingDecoratorService::Execute(const Order& order) {
+  const Clock::time_point kNow = Clock::now();
+  CloseExpired(kNow);
+  Add(order, kNow);
+  Send();
+}
+
+void NettingDecoratorService::ExecuteBatch(
+    const std::span<const Order> orders) {
+  const Clock::time_point kNow = Clock::now();
+  CloseExpired(kNow);
+  for (const Order& order : orders) Add(order, kNow);
+  Send();
+}
+
+void NettingDecoratorService::Poll() {
+  CloseExpired(Clock::now());
+  Send();
+}
+
+void NettingDecoratorService::Flush() {
+  CloseExpired(Clock::time_point::max());
+  Send();
+}
+
+void NettingDecoratorService::Add(const Order& order,
+                                  const Clock::time_point kNow) {
+  ++received_;
+  const auto [kEntry, kOpened] = open_.try_emplace(order.symbol_);
+  Window& window = kEntry->second;
+  if (kOpened) {
+    window.opened_ = kNow;
+    by_age_.emplace_back(order.symbol_, kNow);
+  }
+  window.quantity_ += order.quantity_;
+  if (order.quantity_ > 0) window.buy_price_ = order.price_;
+  if (order.quantity_ < 0) window.sell_price_ = order.price_;
+  if (++window.orders_ >= options_.max_orders_) Close(kEntry);
+}
+
+// Every window is window_ long, so they expire in the order they opened.
+void NettingDecoratorService::CloseExpired(const Clock::time_point kNow) {
+  while (!by_age_.empty()) {
+    const auto& [kSymbol, kOpened] = by_age_.front();
+    if (kNow != Clock::time_point::max() &&
+        kNow - kOpened < options_.window_) {
+      return;
+    }
+    const auto kEntry = open_.find(kSymbol);
+    if (kEntry != open_.end() && kEntry->second.opened_ == kOpened) {
+      Close(kEntry);
+    }
+    by_age_.pop_front();
+  }
+}
+
+void NettingDecoratorService::Close(
+    const absl::flat_hash_map<Symbol, Window>::iterator kEntry) {
+  const Window& kWindow = kEntry->second;
+  if (kWindow.quantity_ != 0) {
+    closed_.push_back({.symbol_ = kEntry->first,
+                       .price_ = kWindow.quantity_ > 0 ? kWindow.buy_price_
+                                                       : kWindow.sell_price_,
+                       .quantity_ = kWindow.quantity_});
+  }
+  open_.erase(kEntry);
+}
+
+void NettingDecoratorService::Send() {
+  if (closed_.empty()) return;
+  forwarded_ += closed_.size();
+  if (closed_.size() == 1) {
+    Inner().Execute(closed_.front());
+  } else {
+    Inner().ExecuteBatch(closed_);
+  }
+  closed_.clear();
+}
@@ -0,0 +1,91 @@
+#ifndef GOF23_NETTING_DECORATOR_H
+#define GOF23_NETTING_DECORATOR_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+
+#include "decorator.h"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+// Coalesces bursts of orders in the same symbol into one. The first order
+// in a symbol opens a window; later ones add their quantity to it, buys
+// positive and sells negative. The window closes after window_, or once it
+// holds max_orders_ orders, and only its net goes on: a net buy at the
+// price of the window's latest buy, a net sell at its latest sell's. A
+// window that nets to zero sends nothing.
+//
+// There is no timer thread: expired windows are closed by the next order
+// through, by Poll(), or by Flush(), which closes every window. A caller
+// with quiet spells should Poll() on its own heartbeat. Destroying the
+// decorator flushes it. Not thread-safe.
+class NettingDecoratorService final : public OrderServiceDecorator {
+ public:
+  struct Options {
+    std::chrono::nanoseconds window_ = std::chrono::microseconds(50);
+    std::size_t max_orders_ = 64;
+  };
+
+  explicit NettingDecoratorService(std::unique_ptr<IOrderService> inner);
+  NettingDecoratorService(std::unique_ptr<IOrderService> inner,
+                          Options options);
+  ~NettingDecoratorService() override;
+
+  NettingDecoratorService(const NettingDecoratorService&) = delete;
+  NettingDecoratorService& operator=(const NettingDecoratorService&) = delete;
+
+  void Execute(const Order& order) override;
+
+  // The whole batch shares one timestamp, and the nets it closes go on as
+  // one batch.
+  void ExecuteBatch(std::span<const Order> orders) override;
+
+  // Closes the windows that have run their time.
+  void Poll();
+
+  // Closes every window.
+  void Flush();
+
+  [[nodiscard]] std::size_t OpenWindows() const { return open_.size(); }
+  [[nodiscard]] std::size_t Received() const { return received_; }
+  [[nodiscard]] std::size_t Forwarded() const { return forwarded_; }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Window {
+    std::int64_t quantity_ = 0;
+    std::int64_t buy_price_ = 0;   // of the latest buy
+    std::int64_t sell_price_ = 0;  // of the latest sell
+    std::size_t orders_ = 0;
+    Clock::time_point opened_;
+  };
+
+  void Add(const Order& order, Clock::time_point now);
+  void CloseExpired(Clock::time_point now);
+  void Close(absl::flat_hash_map<Symbol, Window>::iterator entry);
+
+  // Passes on the nets closed so far.
+  void Send();
+
+  Options options_;
+  absl::flat_hash_map<Symbol, Window> open_;
+  // Windows by opening time, oldest first. Entries for windows that have
+  // since closed are skipped when reached.
+  std::deque<std::pair<Symbol, Clock::time_point>> by_age_;
+  std::vector<Order> closed_;
+  std::size_t received_ = 0;
+  std::size_t forwarded_ = 0;
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_NETTING_DECORATOR_H
@@ -0,0 +1,120 @@
+#ifndef GOF23_SYMBOL_MAP_H
+#define GOF23_SYMBOL_MAP_H
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include "decorator.h"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+// A fixed-capacity map from Symbol to T that threads can insert into and
+// read from without a lock, for decorators that keep per-symbol state on
+// the order path. Entries are never removed. Each slot's T is built with
+// the table and lives as long as it, so it should be atomic, or otherwise
+// safe to share, if threads touch it concurrently.
+//
+// The symbol's six bytes, with bit 63 set, are the key; a slot is claimed
+// by a CAS of its key from 0. The table has twice as many slots as
+// symbols it admits, which keeps linear probes short as it fills.
+// kSlotAlign pads each slot, e.g. to a cache line for values written by
+// many threads at once.
+template <class T, std::size_t kSlotAlign = alignof(std::uint64_t)>
+class SymbolMap {
+ public:
+  explicit SymbolMap(const std::size_t kCapacity)
+      : capacity_(kCapacity),
+        mask_(std::bit_ceil(std::max<std::size_t>(kCapacity, 1) * 2) - 1),
+        slots_(std::make_unique<Slot[]>(mask_ + 1)) {}
+
+  // The symbol's value, claiming a slot on first sight; null once
+  // Capacity() symbols are in.
+  T* FindOrInsert(const Symbol& symbol) {
+    const std::uint64_t kKey = Key(symbol);
+    std::size_t slot = Home(kKey);
+    for (std::size_t probe = 0; probe <= mask_;
+         ++probe, slot = (slot + 1) & mask_) {
+      Slot& entry = slots_[slot];
+      std::uint64_t key = entry.key_.load(std::memory_order_acquire);
+      if (key == 0) {
+        if (size_.fetch_add(1, std::memory_order_relaxed) >= capacity_) {
+          size_.fetch_sub(1, std::memory_order_relaxed);
+          return nullptr;
+        }
+        if (entry.key_.compare_exchange_strong(key, kKey,
+                                               std::memory_order_acq_rel)) {
+          return &entry.value_;
+        }
+        // Another thread took the slot first, perhaps for this symbol.
+        size_.fetch_sub(1, std::memory_order_relaxed);
+      }
+      if (key == kKey) return &entry.value_;
+    }
+    return nullptr;
+  }
+
+  [[nodiscard]] const T* Find(const Symbol& symbol) const {
+    const std::uint64_t kKey = Key(symbol);
+    std::size_t slot = Home(kKey);
+    for (std::size_t probe = 0; probe <= mask_;
+         ++probe, slot = (slot + 1) & mask_) {
+      const std::uint64_t kFound =
+          slots_[slot].key_.load(std::memory_order_acquire);
+      if (kFound == kKey) return &slots_[slot].value_;
+      if (kFound == 0) return nullptr;
+    }
+    return nullptr;
+  }
+
+  // Calls fn(const Symbol&, const T&) for every symbol in, in slot order.
+  template <class Fn>
+  void ForEach(Fn&& fn) const {
+    for (std::size_t i = 0; i <= mask_; ++i) {
+      const std::uint64_t kKey = slots_[i].key_.load(std::memory_order_acquire);
+      if (kKey == 0) continue;
+      Symbol symbol;
+      std::memcpy(symbol.data(), &kKey, symbol.size());
+      fn(static_cast<const Symbol&>(symbol), slots_[i].value_);
+    }
+  }
+
+  [[nodiscard]] std::size_t Capacity() const { return capacity_; }
+  [[nodiscard]] std::size_t Size() const {
+    return std::min(size_.load(std::memory_order_relaxed), capacity_);
+  }
+
+ private:
+  static_assert(sizeof(Symbol) < sizeof(std::uint64_t));
+
+  struct alignas(kSlotAlign) Slot {
+    std::atomic<std::uint64_t> key_{0};  // 0 while free
+    T value_{};
+  };
+
+  static std::uint64_t Key(const Symbol& symbol) {
+    std::uint64_t key = 0;
+    std::memcpy(&key, symbol.data(), symbol.size());
+    return key | (std::uint64_t{1} << 63);
+  }
+
+  // Fibonacci hashing: the symbol bytes are mostly letters, so their low
+  // bits alone would crowd a few slots.
+  [[nodiscard]] std::size_t Home(const std::uint64_t kKey) const {
+    return static_cast<std::size_t>((kKey * 0x9E3779B97F4A7C15ULL) >> 32) &
+           mask_;
+  }
+
+  std::size_t capacity_;
+  std::size_t mask_;  // slot count less one; the count is a power of two
+  std::unique_ptr<Slot[]> slots_;
+  std::atomic<std::size_t> size_{0};
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_SYMBOL_MAP_H
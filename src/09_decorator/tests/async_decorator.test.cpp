@@ -0,0 +1,147 @@
+#include "async_decorator.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "decorator.h"
+
+namespace {
+
+// Records the quantities that reach it, and the size of every call. Runs
+// on the consumer thread; read it only after Drain.
+class RecordingService final : public IOrderService {
+ public:
+  void Execute(const Order& order) override {
+    quantities_.push_back(order.quantity_);
+    calls_.push_back(1);
+  }
+  void ExecuteBatch(std::span<const Order> orders) override {
+    for (const Order& order : orders) quantities_.push_back(order.quantity_);
+    calls_.push_back(orders.size());
+  }
+  std::vector<std::int64_t> quantities_;
+  std::vector<std::size_t> calls_;
+};
+
+// Appends quantities to a vector that outlives it.
+class AppendingService final : public IOrderService {
+ public:
+  explicit AppendingService(std::vector<std::int64_t>& seen) : seen_(seen) {}
+  void Execute(const Order& order) override {
+    seen_.push_back(order.quantity_);
+  }
+
+ private:
+  std::vector<std::int64_t>& seen_;
+};
+
+// Holds the consumer inside Execute until opened.
+class GateService final : public IOrderService {
+ public:
+  void Execute(const Order& /*order*/) override {
+    entered_.store(true);
+    entered_.notify_one();
+    open_.wait(false);
+    ++orders_;
+  }
+  std::atomic<bool> entered_{false};
+  std::atomic<bool> open_{false};
+  int orders_ = 0;
+};
+
+std::vector<Order> MakeOrders(const std::size_t kCount) {
+  std::vector<Order> orders(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    orders[i] = {.symbol_ = {"AAPL"},
+                 .price_ = 1,
+                 .quantity_ = static_cast<std::int64_t>(i)};
+  }
+  return orders;
+}
+
+std::vector<std::int64_t> Quantities(const std::size_t kCount) {
+  std::vector<std::int64_t> quantities(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    quantities[i] = static_cast<std::int64_t>(i);
+  }
+  return quantities;
+}
+
+}  // namespace
+
+class AsyncDecoratorSuite : public ::testing::Test {};
+
+TEST_F(AsyncDecoratorSuite, ShouldDeliverEveryOrderInOrder) {
+  auto recorder = std::make_unique<RecordingService>();
+  RecordingService& inner = *recorder;
+  AsyncOrderService service(std::move(recorder), {.capacity_ = 64});
+
+  for (const Order& order : MakeOrders(10000)) service.Execute(order);
+  service.Drain();
+  EXPECT_EQ(inner.quantities_, Quantities(10000));
+}
+
+TEST_F(AsyncDecoratorSuite, ShouldHandOffRunsOfAtMostMaxBatch) {
+  auto recorder = std::make_unique<RecordingService>();
+  RecordingService& inner = *recorder;
+  AsyncOrderService service(std::move(recorder),
+                            {.capacity_ = 256, .max_batch_ = 16});
+
+  service.ExecuteBatch(MakeOrders(200));
+  service.Drain();
+  EXPECT_EQ(inner.quantities_, Quantities(200));
+  for (const std::size_t kCall : inner.calls_) EXPECT_LE(kCall, 16);
+}
+
+TEST_F(AsyncDecoratorSuite, ShouldDropWhenFullUnderTheDropPolicy) {
+  auto gate = std::make_unique<GateService>();
+  GateService& inner = *gate;
+  AsyncOrderService service(
+      std::move(gate),
+      {.capacity_ = 4, .policy_ = AsyncOrderService::Policy::kDrop});
+
+  const std::vector<Order> kOrders = MakeOrders(11);
+  service.Execute(kOrders[0]);
+  // Order 0 keeps its slot while the consumer is inside it, so three of
+  // the next ten fit.
+  inner.entered_.wait(false);
+  service.ExecuteBatch(std::span(kOrders).subspan(1));
+  EXPECT_EQ(service.Dropped(), 7);
+
+  inner.open_.store(true);
+  inner.open_.notify_one();
+  service.Drain();
+  EXPECT_EQ(inner.orders_, 4);
+}
+
+TEST_F(AsyncDecoratorSuite, ShouldWaitForRoomUnderBlockAndSpin) {
+  for (const auto kPolicy :
+       {AsyncOrderService::Policy::kBlock, AsyncOrderService::Policy::kSpin}) {
+    auto recorder = std::make_unique<RecordingService>();
+    RecordingService& inner = *recorder;
+    AsyncOrderService service(std::move(recorder),
+                              {.capacity_ = 2, .policy_ = kPolicy});
+
+    for (const Order& order : MakeOrders(2000)) service.Execute(order);
+    service.Drain();
+    EXPECT_EQ(service.Dropped(), 0);
+    EXPECT_EQ(inner.quantities_, Quantities(2000));
+  }
+}
+
+TEST_F(AsyncDecoratorSuite, ShouldDrainWhenDestroyed) {
+  std::vector<std::int64_t> seen;
+  {
+    AsyncOrderService service(std::make_unique<AppendingService>(seen),
+                              {.capacity_ = 8});
+    for (const Order& order : MakeOrders(100)) service.Execute(order);
+  }
+  EXPECT_EQ(seen, Quantities(100));
+}
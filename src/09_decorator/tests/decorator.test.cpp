@@ -4,7 +4,13 @@
 
 #include "decorator.h"
 
+#include <array>
+#include <format>
 #include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
 
 #include <absl/status/status.h>
 #include <absl/status/statusor.h>
@@ -53,4 +59,120 @@ TEST_F(DecoratorSuite, LoggingDecorator_WrapsAndLogs_NoNulls) {
 
   EXPECT_EQ(out, expected);
   EXPECT_EQ(out.find('\0'), std::string::npos);
-}
\ No newline at end of file
+}
+
+namespace {
+
+constexpr std::array<Order, 3> kBatch{{
+    {.symbol_ = {"AAPL"}, .price_ = 2684700, .quantity_ = 100},
+    {.symbol_ = {"MSFT"}, .price_ = 4101250, .quantity_ = 7},
+    {.symbol_ = {"IBM"}, .price_ = 2250000, .quantity_ = 30},
+}};
+
+// Records what reaches it, one call per line.
+class RecordingService final : public IOrderService {
+ public:
+  void Execute(const Order& order) override {
+    calls_ += std::format("one {}\n", order.quantity_);
+  }
+  void ExecuteBatch(std::span<const Order> orders) override {
+    calls_ += std::format("batch {}\n", orders.size());
+  }
+  std::string calls_;
+};
+
+// A decorator written before batches existed.
+class CountingDecoratorService final : public OrderServiceDecorator {
+ public:
+  using OrderServiceDecorator::OrderServiceDecorator;
+  void Execute(const Order& order) override {
+    ++count_;
+    Inner().Execute(order);
+  }
+  int count_ = 0;
+};
+
+}  // namespace
+
+TEST_F(DecoratorSuite, ExchangeService_BatchPrintsLikeSingleOrders) {
+  ExchangeOrderService service;
+
+  StdoutCaptureGuard guard;
+  for (const Order& order : kBatch) service.Execute(order);
+  const std::string one_by_one = guard.Capture();
+  guard.Resume();
+  service.ExecuteBatch(kBatch);
+  const std::string batched = guard.Capture();
+
+  EXPECT_EQ(batched, one_by_one);
+  EXPECT_EQ(batched,
+            "[ORDER] AAPL : $268.4700 x 100\n"
+            "[ORDER] MSFT : $410.1250 x 7\n"
+            "[ORDER] IBM  : $225.0000 x 30\n");
+}
+
+TEST_F(DecoratorSuite, LoggingDecorator_LogsOncePerBatch) {
+  auto recorder = std::make_unique<RecordingService>();
+  RecordingService& inner = *recorder;
+  LoggingDecoratorService service(std::move(recorder));
+
+  StdoutCaptureGuard guard;
+  service.ExecuteBatch(kBatch);
+  EXPECT_EQ(guard.Capture(),
+            "[LOG  ] Placing 3 orders\n"
+            "[LOG  ] Completed 3 orders\n");
+  EXPECT_EQ(inner.calls_, "batch 3\n");
+}
+
+TEST_F(DecoratorSuite, Decorator_WithoutBatchPath_FallsBackPerOrder) {
+  auto recorder = std::make_unique<RecordingService>();
+  RecordingService& inner = *recorder;
+  CountingDecoratorService service(std::move(recorder));
+
+  service.ExecuteBatch(kBatch);
+  EXPECT_EQ(service.count_, 3);
+  EXPECT_EQ(inner.calls_, "one 100\none 7\none 30\n");
+}
+
+TEST_F(DecoratorSuite, RiskCheck_ForwardsOnlyPassingOrders) {
+  auto recorder = std::make_unique<RecordingService>();
+  RecordingService& inner = *recorder;
+  RiskCheckDecoratorService service(
+      std::move(recorder), {.max_quantity_ = 50, .max_notional_ = 1e6});
+
+  StdoutCaptureGuard guard;
+  service.ExecuteBatch(std::span(kBatch).subspan(1));
+  service.ExecuteBatch(kBatch);
+  service.Execute(kBatch[0]);
+  service.Execute(Order{.symbol_ = {"X"}, .price_ = 0, .quantity_ = 1});
+  service.Execute(kBatch[2]);
+  EXPECT_EQ(guard.Capture(),
+            "[CHECK] Rejected 1 of 3 orders\n"
+            "[CHECK] Rejected order\n"
+            "[CHECK] Rejected order\n");
+
+  EXPECT_EQ(inner.calls_, "batch 2\nbatch 2\none 30\n");
+  EXPECT_EQ(service.Rejected(), 3U);
+}
+
+TEST_F(DecoratorSuite, ExchangeService_FormatsFixedPointPrices) {
+  ExchangeOrderService service;
+  constexpr std::array<Order, 4> kOrders{{
+      {.symbol_ = {"GOOGL"}, .price_ = 5, .quantity_ = 1},
+      {.symbol_ = {"F"}, .price_ = 120000, .quantity_ = 0},
+      {.symbol_ = {"BRK"}, .price_ = 72'000'000'000, .quantity_ = 2},
+      {.symbol_ = {"NEG"}, .price_ = -12345, .quantity_ = -3},
+  }};
+
+  std::string expected;
+  for (const Order& order : kOrders) {
+    expected += std::format(
+        "[ORDER] {: <5}: ${:.4f} x {}\n",
+        std::string_view(order.symbol_.data()),
+        static_cast<double>(order.price_) / kPriceMultiplier, order.quantity_);
+  }
+
+  StdoutCaptureGuard guard;
+  service.ExecuteBatch(kOrders);
+  EXPECT_EQ(guard.Capture(), expected);
+}
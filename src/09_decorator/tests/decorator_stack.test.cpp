@@ -0,0 +1,98 @@
+#include "decorator_stack.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "../helpers/StdoutCaptureGuard.h"
+#include "decorator.h"
+
+class DecoratorStackSuite : public ::testing::Test {
+ protected:
+  static constexpr Order kOrder{
+      .symbol_ = {"AAPL"}, .price_ = 2684700, .quantity_ = 100};
+
+  // Appends its tag to a shared trace on the way down and on the way up.
+  class Tag {
+   public:
+    Tag() = default;
+    Tag(std::string* trace, char tag) : trace_(trace), tag_(tag) {}
+
+    template <class Next>
+    void Execute(const Order& kOrder, Next&& next) {
+      *trace_ += tag_;
+      std::forward<Next>(next)(kOrder);
+      *trace_ += tag_;
+    }
+
+   private:
+    std::string* trace_ = nullptr;
+    char tag_ = '?';
+  };
+
+  // Passes only orders of at most max_quantity_ shares.
+  struct SizeLimit {
+    template <class Next>
+    void Execute(const Order& kOrder, Next&& next) {
+      if (kOrder.quantity_ <= max_quantity_) std::forward<Next>(next)(kOrder);
+    }
+    std::int64_t max_quantity_ = 0;
+  };
+
+  struct Sink {
+    void Execute(const Order& kOrder) { filled_ += kOrder.quantity_; }
+    std::int64_t filled_ = 0;
+  };
+};
+
+TEST_F(DecoratorStackSuite, ShouldPrintLikeTheRuntimeChain) {
+  std::unique_ptr<IOrderService> chain =
+      std::make_unique<LoggingDecoratorService>(
+          std::make_unique<ExchangeOrderService>());
+  Stack<LoggingLayer, ExchangeOrderService> stack;
+
+  StdoutCaptureGuard guard;
+  chain->Execute(kOrder);
+  const std::string kChain = guard.Capture();
+  guard.Resume();
+  stack.Execute(kOrder);
+  const std::string kStack = guard.Capture();
+
+  EXPECT_EQ(kStack, kChain);
+}
+
+TEST_F(DecoratorStackSuite, ShouldRunLayersTopDown) {
+  std::string trace;
+  Stack<Tag, Tag, Tag, Sink> stack(Tag(&trace, 'a'), Tag(&trace, 'b'),
+                                   Tag(&trace, 'c'), Sink{});
+  stack.Execute(kOrder);
+  EXPECT_EQ(trace, "abccba");
+  EXPECT_EQ(stack.Layer<3>().filled_, 100);
+}
+
+TEST_F(DecoratorStackSuite, ShouldLetALayerDropAnOrder) {
+  Stack<SizeLimit, Sink> stack(SizeLimit{.max_quantity_ = 50}, Sink{});
+  stack.Execute(kOrder);
+  EXPECT_EQ(stack.Layer<1>().filled_, 0);
+  stack.Execute(Order{.symbol_ = {"AAPL"}, .price_ = 1, .quantity_ = 40});
+  EXPECT_EQ(stack.Layer<1>().filled_, 40);
+}
+
+TEST_F(DecoratorStackSuite, ShouldNestInARuntimeChain) {
+  auto stack = std::make_unique<StackOrderService<LoggingLayer, Sink>>();
+  auto& sink = stack->Get().Layer<1>();
+  std::unique_ptr<IOrderService> chain =
+      std::make_unique<LoggingDecoratorService>(std::move(stack));
+
+  StdoutCaptureGuard guard;
+  chain->Execute(kOrder);
+  EXPECT_EQ(guard.Capture(),
+            "[LOG  ] Placing order\n"
+            "[LOG  ] Placing order\n"
+            "[LOG  ] Completed order\n"
+            "[LOG  ] Completed order\n");
+  EXPECT_EQ(sink.filled_, 100);
+}
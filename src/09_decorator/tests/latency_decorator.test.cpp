@@ -0,0 +1,108 @@
+#include "latency_decorator.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../helpers/LatencyHistogram.h"
+#include "decorator.h"
+
+namespace {
+
+// Counts what reaches it.
+class SinkService final : public IOrderService {
+ public:
+  void Execute(const Order& /*order*/) override { ++orders_; }
+  int orders_ = 0;
+};
+
+}  // namespace
+
+class LatencyDecoratorSuite : public ::testing::Test {};
+
+TEST_F(LatencyDecoratorSuite, ShouldBucketWithinThreePercent) {
+  LatencyHistogram histogram;
+  for (std::uint64_t v = 1; v <= 10000; ++v) histogram.Record(v);
+
+  const LatencyHistogram::Summary kSummary = histogram.Summarize();
+  EXPECT_EQ(kSummary.count_, 10000);
+  EXPECT_EQ(kSummary.max_, 10000);
+  EXPECT_GE(kSummary.p50_, 5000);
+  EXPECT_LE(kSummary.p50_, 5000 * 1.032);
+  EXPECT_GE(kSummary.p99_, 9900);
+  EXPECT_LE(kSummary.p99_, 10000);
+  EXPECT_EQ(histogram.Percentile(1.0), 10000);
+
+  // Small values have buckets of their own.
+  LatencyHistogram small;
+  for (std::uint64_t v = 0; v < 20; ++v) small.Record(v);
+  EXPECT_EQ(small.Percentile(0.5), 9);
+  EXPECT_EQ(LatencyHistogram().Percentile(0.5), 0);
+}
+
+TEST_F(LatencyDecoratorSuite, ShouldCountEveryRecordAcrossThreads) {
+  constexpr int kThreads = 4;
+  constexpr int kRecords = 50000;
+  LatencyHistogram histogram;
+  {
+    std::vector<std::jthread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+      threads.emplace_back([&histogram, t] {
+        for (int i = 0; i < kRecords; ++i) {
+          histogram.Record(static_cast<std::uint64_t>((i * kThreads) + t));
+        }
+      });
+    }
+  }
+  EXPECT_EQ(histogram.Count(), kThreads * kRecords);
+  EXPECT_EQ(histogram.Summarize().count_, kThreads * kRecords);
+  EXPECT_EQ(histogram.Max(), (kThreads * kRecords) - 1);
+}
+
+TEST_F(LatencyDecoratorSuite, ShouldTimeEachOrderBySymbol) {
+  auto sink = std::make_unique<SinkService>();
+  SinkService& inner = *sink;
+  LatencyDecoratorService service(std::move(sink));
+
+  const Order kApple{.symbol_ = {"AAPL"}, .price_ = 1, .quantity_ = 1};
+  const Order kIbm{.symbol_ = {"IBM"}, .price_ = 1, .quantity_ = 1};
+  for (int i = 0; i < 3; ++i) service.Execute(kApple);
+  service.Execute(kIbm);
+  service.ExecuteBatch(std::vector<Order>{kApple, kIbm});
+
+  EXPECT_EQ(inner.orders_, 6);
+  EXPECT_EQ(service.Overall().Count(), 4);
+  EXPECT_EQ(service.Batches().Count(), 1);
+  ASSERT_NE(service.ForSymbol(kApple.symbol_), nullptr);
+  EXPECT_EQ(service.ForSymbol(kApple.symbol_)->Count(), 3);
+  EXPECT_EQ(service.ForSymbol(kIbm.symbol_)->Count(), 1);
+  EXPECT_EQ(service.ForSymbol(Symbol{"MSFT"}), nullptr);
+
+  const std::string kReport = service.Report();
+  EXPECT_EQ(kReport.find("all     n=4 "), 0) << kReport;
+  EXPECT_NE(kReport.find("\nbatches n=1 "), std::string::npos) << kReport;
+  const auto kAppleLine = kReport.find("\nAAPL    n=3 p50=");
+  const auto kIbmLine = kReport.find("\nIBM     n=1 p50=");
+  ASSERT_NE(kAppleLine, std::string::npos) << kReport;
+  EXPECT_LT(kAppleLine, kIbmLine) << kReport;
+}
+
+TEST_F(LatencyDecoratorSuite, ShouldCountSymbolsPastTheTableAsUntracked) {
+  LatencyDecoratorService service(std::make_unique<SinkService>(),
+                                  {.max_symbols_ = 2});
+  for (const char* name : {"A", "B", "C", "A", "D"}) {
+    Order order{.price_ = 1, .quantity_ = 1};
+    order.symbol_[0] = name[0];
+    service.Execute(order);
+  }
+  EXPECT_EQ(service.Overall().Count(), 5);
+  EXPECT_EQ(service.ForSymbol(Symbol{"A"})->Count(), 2);
+  EXPECT_EQ(service.ForSymbol(Symbol{"C"}), nullptr);
+  EXPECT_EQ(service.Untracked(), 2);
+  EXPECT_NE(service.Report().find("untracked n=2\n"), std::string::npos);
+}
@@ -0,0 +1,168 @@
+#include "netting_decorator.h"
+
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../helpers/StdoutCaptureGuard.h"
+#include "decorator.h"
+
+namespace {
+
+// Records what reaches it, one call per line, into a string that
+// outlives it.
+class RecordingService final : public IOrderService {
+ public:
+  explicit RecordingService(std::string& calls) : calls_(calls) {}
+  void Execute(const Order& order) override {
+    calls_ += std::format("one {}\n", Describe(order));
+  }
+  void ExecuteBatch(std::span<const Order> orders) override {
+    calls_ += "batch";
+    for (const Order& order : orders) {
+      calls_ += ' ';
+      calls_ += Describe(order);
+    }
+    calls_ += "\n";
+  }
+
+ private:
+  static std::string Describe(const Order& order) {
+    return std::format("{}:{}@{}", std::string_view(order.symbol_.data()),
+                       order.quantity_, order.price_);
+  }
+
+  std::string& calls_;
+};
+
+Order MakeOrder(const Symbol& symbol, const std::int64_t kQuantity,
+                const std::int64_t kPrice = 100) {
+  return {.symbol_ = symbol, .price_ = kPrice, .quantity_ = kQuantity};
+}
+
+constexpr NettingDecoratorService::Options kLongWindow{
+    .window_ = std::chrono::hours(1), .max_orders_ = 64};
+
+}  // namespace
+
+class NettingDecoratorSuite : public ::testing::Test {};
+
+TEST_F(NettingDecoratorSuite, ShouldSendNothingWhenOrdersNetToZero) {
+  std::string calls;
+  NettingDecoratorService service(std::make_unique<RecordingService>(calls),
+                                  kLongWindow);
+
+  service.Execute(MakeOrder({"AAPL"}, 100));
+  service.Execute(MakeOrder({"AAPL"}, -40));
+  service.ExecuteBatch(std::vector{MakeOrder({"AAPL"}, -60)});
+  service.Flush();
+  EXPECT_EQ(calls, "");
+  EXPECT_EQ(service.Received(), 3);
+  EXPECT_EQ(service.Forwarded(), 0);
+  EXPECT_EQ(service.OpenWindows(), 0);
+}
+
+TEST_F(NettingDecoratorSuite, ShouldSendOneNetOrderPerSymbol) {
+  std::string calls;
+  NettingDecoratorService service(std::make_unique<RecordingService>(calls),
+                                  kLongWindow);
+
+  service.ExecuteBatch(std::vector{MakeOrder({"AAPL"}, 100, 101),
+                                   MakeOrder({"IBM"}, 5, 200),
+                                   MakeOrder({"AAPL"}, -30, 102)});
+  service.Execute(MakeOrder({"MSFT"}, -7, 300));
+  EXPECT_EQ(calls, "");
+  EXPECT_EQ(service.OpenWindows(), 3);
+
+  service.Flush();
+  EXPECT_EQ(calls, "batch AAPL:70@101 IBM:5@200 MSFT:-7@300\n");
+  EXPECT_EQ(service.Forwarded(), 3);
+}
+
+TEST_F(NettingDecoratorSuite, ShouldPriceTheNetFromItsOwnSide) {
+  std::string calls;
+  NettingDecoratorService service(std::make_unique<RecordingService>(calls),
+                                  kLongWindow);
+
+  // A buy of 100 @ 10 against a sell of 60 @ 12 is a buy of 40, and must
+  // not go out at the sell's 12.
+  service.ExecuteBatch(std::vector{
+      MakeOrder({"AAPL"}, 100, 10), MakeOrder({"AAPL"}, -60, 12),
+      MakeOrder({"IBM"}, -50, 20), MakeOrder({"IBM"}, 10, 25),
+      MakeOrder({"IBM"}, -5, 19), MakeOrder({"MSFT"}, 5, 30),
+      MakeOrder({"MSFT"}, 7, 31), MakeOrder({"MSFT"}, -2, 29)});
+  service.Flush();
+  EXPECT_EQ(calls, "batch AAPL:40@10 IBM:-45@19 MSFT:10@31\n");
+}
+
+TEST_F(NettingDecoratorSuite, ShouldCloseAWindowAtItsOrderLimit) {
+  std::string calls;
+  NettingDecoratorService service(
+      std::make_unique<RecordingService>(calls),
+      {.window_ = std::chrono::hours(1), .max_orders_ = 3});
+
+  for (int i = 0; i < 4; ++i) service.Execute(MakeOrder({"AAPL"}, 1));
+  EXPECT_EQ(calls, "one AAPL:3@100\n");
+  EXPECT_EQ(service.OpenWindows(), 1);
+}
+
+TEST_F(NettingDecoratorSuite, ShouldCloseAWindowOnceItsTimeIsUp) {
+  std::string calls;
+  NettingDecoratorService service(
+      std::make_unique<RecordingService>(calls),
+      {.window_ = std::chrono::milliseconds(2), .max_orders_ = 64});
+
+  service.Execute(MakeOrder({"AAPL"}, 10));
+  service.Poll();
+  EXPECT_EQ(calls, "");
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  service.Poll();
+  EXPECT_EQ(calls, "one AAPL:10@100\n");
+
+  // The next order closes an expired window too, before opening its own.
+  service.Execute(MakeOrder({"IBM"}, 1));
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  service.Execute(MakeOrder({"IBM"}, 2));
+  EXPECT_EQ(calls, "one AAPL:10@100\none IBM:1@100\n");
+}
+
+TEST_F(NettingDecoratorSuite, ShouldFlushWhenDestroyed) {
+  std::string calls;
+  {
+    NettingDecoratorService service(std::make_unique<RecordingService>(calls),
+                                    kLongWindow);
+    service.Execute(MakeOrder({"AAPL"}, 4));
+    EXPECT_EQ(calls, "");
+  }
+  EXPECT_EQ(calls, "one AAPL:4@100\n");
+}
+
+TEST_F(NettingDecoratorSuite, ShouldHaveNetSellsRiskCheckedBySize) {
+  std::string calls;
+  auto risk_check = std::make_unique<RiskCheckDecoratorService>(
+      std::make_unique<RecordingService>(calls),
+      RiskCheckDecoratorService::Options{.max_quantity_ = 50,
+                                         .max_notional_ = 1e6});
+  RiskCheckDecoratorService& checked = *risk_check;
+  NettingDecoratorService service(std::move(risk_check), kLongWindow);
+
+  service.ExecuteBatch(std::vector{MakeOrder({"AAPL"}, 10),
+                                   MakeOrder({"AAPL"}, -40),
+                                   MakeOrder({"IBM"}, -80),
+                                   MakeOrder({"MSFT"}, 60),
+                                   MakeOrder({"MSFT"}, -20)});
+  StdoutCaptureGuard guard;
+  service.Flush();
+  EXPECT_EQ(guard.Capture(), "[CHECK] Rejected 1 of 3 orders\n");
+  EXPECT_EQ(calls, "batch AAPL:-30@100 MSFT:40@100\n");
+  EXPECT_EQ(checked.Rejected(), 1U);
+}
@@ -0,0 +1,114 @@
+#include "throttle_decorator.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "decorator.h"
+
+namespace {
+
+constexpr std::int64_t kStart = 1'000'000'000'000;
+constexpr std::int64_t kMillisecond = 1'000'000;
+
+constexpr Order kApple{.symbol_ = {"AAPL"}, .price_ = 1, .quantity_ = 1};
+constexpr Order kIbm{.symbol_ = {"IBM"}, .price_ = 1, .quantity_ = 1};
+
+// Counts what reaches it.
+class SinkService final : public IOrderService {
+ public:
+  void Execute(const Order& /*order*/) override { ++orders_; }
+  int orders_ = 0;
+};
+
+}  // namespace
+
+class ThrottleDecoratorSuite : public ::testing::Test {};
+
+TEST_F(ThrottleDecoratorSuite, ShouldAdmitABurstThenTheRate) {
+  ThrottleDecoratorService service(
+      std::make_unique<SinkService>(),
+      {.orders_per_second_ = 1000, .burst_ = 3,
+       .symbol_orders_per_second_ = 0});
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_TRUE(service.Admit(kApple.symbol_, kStart)) << i;
+  }
+  EXPECT_FALSE(service.Admit(kIbm.symbol_, kStart));
+  EXPECT_TRUE(service.Admit(kIbm.symbol_, kStart + kMillisecond));
+  EXPECT_FALSE(service.Admit(kIbm.symbol_, kStart + kMillisecond));
+  EXPECT_TRUE(service.Admit(kIbm.symbol_, kStart + (10 * kMillisecond)));
+}
+
+TEST_F(ThrottleDecoratorSuite, ShouldTakeBothTokensOrNeither) {
+  ThrottleDecoratorService service(
+      std::make_unique<SinkService>(),
+      {.orders_per_second_ = 1000, .burst_ = 2,
+       .symbol_orders_per_second_ = 1, .symbol_burst_ = 2});
+  EXPECT_TRUE(service.Admit(kApple.symbol_, kStart));
+  EXPECT_TRUE(service.Admit(kApple.symbol_, kStart));
+  EXPECT_FALSE(service.Admit(kApple.symbol_, kStart + kMillisecond));
+
+  // IBM's own bucket is full, but the global one is empty; its token goes
+  // back, so both of IBM's are still there once the global one refills.
+  EXPECT_FALSE(service.Admit(kIbm.symbol_, kStart));
+  EXPECT_TRUE(service.Admit(kIbm.symbol_, kStart + kMillisecond));
+  EXPECT_TRUE(service.Admit(kIbm.symbol_, kStart + (2 * kMillisecond)));
+  EXPECT_FALSE(service.Admit(kIbm.symbol_, kStart + (3 * kMillisecond)));
+}
+
+TEST_F(ThrottleDecoratorSuite, ShouldRejectOrdersOverBudget) {
+  auto sink = std::make_unique<SinkService>();
+  SinkService& inner = *sink;
+  ThrottleDecoratorService service(
+      std::move(sink), {.orders_per_second_ = 1, .burst_ = 3});
+
+  for (int i = 0; i < 2; ++i) service.Execute(kApple);
+  service.ExecuteBatch(std::vector<Order>{kIbm, kApple, kIbm});
+  EXPECT_EQ(inner.orders_, 3);
+  EXPECT_EQ(service.Rejected(), 2);
+}
+
+TEST_F(ThrottleDecoratorSuite, ShouldWaitForTokensUnderTheWaitPolicy) {
+  auto sink = std::make_unique<SinkService>();
+  SinkService& inner = *sink;
+  ThrottleDecoratorService service(
+      std::move(sink),
+      {.orders_per_second_ = 500, .burst_ = 1,
+       .policy_ = ThrottleDecoratorService::Policy::kWait});
+
+  const auto kBegin = std::chrono::steady_clock::now();
+  for (int i = 0; i < 4; ++i) service.Execute(kApple);
+  const auto kElapsed = std::chrono::steady_clock::now() - kBegin;
+  EXPECT_EQ(inner.orders_, 4);
+  EXPECT_EQ(service.Rejected(), 0);
+  EXPECT_GE(kElapsed, std::chrono::milliseconds(6));
+}
+
+TEST_F(ThrottleDecoratorSuite, ShouldHandOutExactlyTheBurstAcrossThreads) {
+  constexpr int kThreads = 4;
+  constexpr int kAttempts = 10000;
+  ThrottleDecoratorService service(
+      std::make_unique<SinkService>(),
+      {.orders_per_second_ = 1, .burst_ = 1000,
+       .symbol_orders_per_second_ = 0});
+  std::atomic<int> admitted{0};
+  {
+    std::vector<std::jthread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+      threads.emplace_back([&service, &admitted] {
+        for (int i = 0; i < kAttempts; ++i) {
+          if (service.Admit(kApple.symbol_, kStart)) {
+            admitted.fetch_add(1, std::memory_order_relaxed);
+          }
+        }
+      });
+    }
+  }
+  EXPECT_EQ(admitted.load(), 1000);
+}
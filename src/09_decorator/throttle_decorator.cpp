@@ -0,0 +1,153 @@
+#include "throttle_decorator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+std::int64_t Now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             Clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
+ThrottleDecoratorService::ThrottleDecoratorService(
+    std::unique_ptr<IOrderService> inner)
+    : ThrottleDecoratorService(std::move(inner), Options{}) {}
+
+ThrottleDecoratorService::ThrottleDecoratorService(
+    std::unique_ptr<IOrderService> inner, Options options)
+    : OrderServiceDecorator(std::move(inner)),
+      global_(MakeLimit(options.orders_per_second_, options.burst_)),
+      symbol_(MakeLimit(options.symbol_orders_per_second_,
+                        options.symbol_burst_)),
+      policy_(options.policy_),
+      symbols_(options.max_symbols_) {}
+
+ThrottleDecoratorService::Limit ThrottleDecoratorService::MakeLimit(
+    const double orders_per_second, const double burst) {
+  if (!(orders_per_second > 0)) return {.interval_ = 0, .depth_ = 0};
+  const auto kInterval = std::max<std::int64_t>(
+      1, std::llround(1e9 / orders_per_second));
+  return {.interval_ = kInterval,
+          .depth_ = kInterval * std::max<std::int64_t>(
+                                    1, std::llround(burst))};
+}
+
+// GCRA: a token moves the bucket's empty time one interval later, starting
+// from now if it is already past. The bucket is over budget when that
+// would put the empty time more than a full bucket ahead of now.
+bool ThrottleDecoratorService::Take(Bucket& bucket, const Limit& kLimit,
+                                    const std::int64_t kNow) {
+  if (kLimit.interval_ == 0) return true;
+  std::int64_t empty_at = bucket.load(std::memory_order_relaxed);
+  while (true) {
+    const std::int64_t kNext = std::max(empty_at, kNow) + kLimit.interval_;
+    if (kNext - kNow > kLimit.depth_) return false;
+    if (bucket.compare_exchange_weak(empty_at, kNext,
+                                     std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+}
+
+void ThrottleDecoratorService::Refund(Bucket& bucket, const Limit& kLimit) {
+  bucket.fetch_sub(kLimit.interval_, std::memory_order_relaxed);
+}
+
+std::int64_t ThrottleDecoratorService::Reserve(Bucket& bucket,
+                                               const Limit& kLimit,
+                                               const std::int64_t kNow) {
+  if (kLimit.interval_ == 0) return kNow;
+  std::int64_t empty_at = bucket.load(std::memory_order_relaxed);
+  std::int64_t next = 0;
+  do {
+    next = std::max(empty_at, kNow) + kLimit.interval_;
+  } while (!bucket.compare_exchange_weak(empty_at, next,
+                                         std::memory_order_relaxed));
+  return next - kLimit.depth_;
+}
+
+ThrottleDecoratorService::Bucket& ThrottleDecoratorService::SymbolBucket(
+    const Symbol& symbol) {
+  Bucket* bucket = symbols_.FindOrInsert(symbol);
+  return bucket != nullptr ? *bucket : overflow_bucket_;
+}
+
+bool ThrottleDecoratorService::Admit(const Symbol& symbol,
+                                     const std::int64_t kNow) {
+  Bucket& symbol_bucket = SymbolBucket(symbol);
+  if (!Take(symbol_bucket, symbol_, kNow)) return false;
+  if (Take(global_bucket_, global_, kNow)) return true;
+  // Both or neither: the symbol's token goes back.
+  if (symbol_.interval_ != 0) Refund(symbol_bucket, symbol_);
+  return false;
+}
+
+void ThrottleDecoratorService::Wait(const std::span<const Order> orders) {
+  const std::int64_t kNow = Now();
+  std::int64_t due = kNow;
+  for (const Order& order : orders) {
+    due = std::max({due, Reserve(SymbolBucket(order.symbol_), symbol_, kNow),
+                    Reserve(global_bucket_, global_, kNow)});
+  }
+  if (due > kNow) {
+    std::this_thread::sleep_until(Clock::time_point(
+        std::chrono::duration_cast<Clock::duration>(
+            std::chrono::nanoseconds(due))));
+  }
+}
+
+void ThrottleDecoratorService::Execute(const Order& order) {
+  if (policy_ == Policy::kWait) {
+    Wait(std::span(&order, 1));
+  } else if (!Admit(order.symbol_, Now())) {
+    rejected_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  Inner().Execute(order);
+}
+
+void ThrottleDecoratorService::ExecuteBatch(
+    const std::span<const Order> orders) {
+  if (policy_ == Policy::kWait) {
+    Wait(orders);
+    Inner().ExecuteBatch(orders);
+    return;
+  }
+
+  const std::int64_t kNow = Now();
+  std::size_t first_rejected = 0;
+  while (first_rejected < orders.size() &&
+         Admit(orders[first_rejected].symbol_, kNow)) {
+    ++first_rejected;
+  }
+  if (first_rejected == orders.size()) {
+    Inner().ExecuteBatch(orders);
+    return;
+  }
+
+  // Local rather than a member, so batches from several threads can be
+  // throttled at once.
+  std::vector<Order> admitted(orders.begin(),
+                              orders.begin() + first_rejected);
+  for (std::size_t i = first_rejected + 1; i < orders.size(); ++i) {
+    if (Admit(orders[i].symbol_, kNow)) admitted.push_back(orders[i]);
+  }
+  rejected_.fetch_add(orders.size() - admitted.size(),
+                      std::memory_order_relaxed);
+  if (!admitted.empty()) Inner().ExecuteBatch(admitted);
+}
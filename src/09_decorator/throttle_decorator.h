@@ -0,0 +1,95 @@
+#ifndef GOF23_THROTTLE_DECORATOR_H
+#define GOF23_THROTTLE_DECORATOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include "decorator.h"
+#include "symbol_map.h"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+// Holds order flow to an orders-per-second budget before it reaches the
+// exchange: a global limit over all orders and a tighter one per symbol.
+// An order needs a token from both, and takes both or neither. Over budget,
+// kReject drops the order and counts it in Rejected(); kWait holds the
+// calling thread until its tokens come due, so callers queue in time.
+//
+// Each bucket is one atomic word in GCRA form: the time at which the
+// bucket would next be empty, advanced by a CAS per order. Checks take no
+// lock, so any number of threads may call Execute at once, provided the
+// inner service is safe to call from them. A rate of 0 turns that limit
+// off. Symbols past max_symbols_ share one overflow bucket with the
+// per-symbol limit.
+class ThrottleDecoratorService final : public OrderServiceDecorator {
+ public:
+  enum class Policy { kReject, kWait };
+
+  struct Options {
+    double orders_per_second_ = 10'000;
+    double burst_ = 100;  // orders that may go back to back
+    double symbol_orders_per_second_ = 1'000;
+    double symbol_burst_ = 20;
+    std::size_t max_symbols_ = 1024;
+    Policy policy_ = Policy::kReject;
+  };
+
+  explicit ThrottleDecoratorService(std::unique_ptr<IOrderService> inner);
+  ThrottleDecoratorService(std::unique_ptr<IOrderService> inner,
+                           Options options);
+
+  void Execute(const Order& order) override;
+
+  // The orders that get tokens go on as one batch. Under kWait the batch
+  // waits for its last order's tokens.
+  void ExecuteBatch(std::span<const Order> orders) override;
+
+  // Takes a token for the symbol at kNow, nanoseconds on steady_clock,
+  // for callers that already hold a timestamp. Does not wait or count
+  // into Rejected().
+  bool Admit(const Symbol& symbol, std::int64_t kNow);
+
+  [[nodiscard]] std::size_t Rejected() const {
+    return rejected_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  // A bucket is the time at which it would next be empty, in ns.
+  using Bucket = std::atomic<std::int64_t>;
+
+  struct Limit {
+    std::int64_t interval_;  // ns per token; 0 when off
+    std::int64_t depth_;     // ns of tokens a full bucket holds
+  };
+
+  static Limit MakeLimit(double orders_per_second, double burst);
+
+  static bool Take(Bucket& bucket, const Limit& kLimit, std::int64_t kNow);
+  static void Refund(Bucket& bucket, const Limit& kLimit);
+
+  // Takes a token even if none is left, and returns when it comes due.
+  static std::int64_t Reserve(Bucket& bucket, const Limit& kLimit,
+                              std::int64_t kNow);
+
+  Bucket& SymbolBucket(const Symbol& symbol);
+
+  // Reserves tokens for every order and sleeps until the last is due.
+  void Wait(std::span<const Order> orders);
+
+  Limit global_;
+  Limit symbol_;
+  Policy policy_;
+  // Each bucket on a line of its own, so threads on different symbols, or
+  // on the global bucket and the counters, do not share one.
+  alignas(64) Bucket global_bucket_{0};
+  alignas(64) Bucket overflow_bucket_{0};
+  SymbolMap<Bucket, 64> symbols_;
+  alignas(64) std::atomic<std::size_t> rejected_{0};
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_THROTTLE_DECORATOR_H
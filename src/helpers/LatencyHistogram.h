@@ -0,0 +1,133 @@
+#ifndef GOF23_LATENCY_HISTOGRAM_H
+#define GOF23_LATENCY_HISTOGRAM_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// Log-linear histogram of latencies in nanoseconds, HdrHistogram style:
+// every power-of-two range is split into kSubBuckets equal buckets, so a
+// bucket is never wider than 1/kSubBuckets (about 3%) of the values in it,
+// and values below kSubBuckets are counted exactly. Values beyond
+// 2^kMaxBits ns (about 18 minutes) land in the last bucket; Max() is exact.
+//
+// Record is one relaxed fetch_add and, only for a new maximum, a CAS, so
+// any number of threads can record without a lock. There is no separate
+// total to keep in step: readers sum the buckets as they find them, and a
+// read racing writers sees some of the concurrent samples and not others,
+// never a torn count.
+//
+// NOLINTBEGIN(readability-identifier-naming)
+
+class LatencyHistogram {
+ public:
+  static constexpr unsigned kSubBucketBits = 5;
+  static constexpr std::uint64_t kSubBuckets = std::uint64_t{1}
+                                               << kSubBucketBits;
+  static constexpr unsigned kMaxBits = 40;
+  static constexpr std::size_t kBuckets =
+      (kMaxBits - kSubBucketBits + 1) * kSubBuckets;
+
+  struct Summary {
+    std::uint64_t count_;
+    std::uint64_t p50_;
+    std::uint64_t p99_;
+    std::uint64_t p999_;
+    std::uint64_t max_;
+  };
+
+  LatencyHistogram() = default;
+  LatencyHistogram(const LatencyHistogram&) = delete;
+  LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+  void Record(const std::uint64_t kNanos) {
+    counts_[Index(kNanos)].fetch_add(1, std::memory_order_relaxed);
+    std::uint64_t max = max_.load(std::memory_order_relaxed);
+    while (kNanos > max && !max_.compare_exchange_weak(
+                               max, kNanos, std::memory_order_relaxed)) {
+    }
+  }
+
+  [[nodiscard]] std::uint64_t Count() const {
+    std::uint64_t total = 0;
+    for (const auto& kCount : counts_) {
+      total += kCount.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+  [[nodiscard]] std::uint64_t Max() const {
+    return max_.load(std::memory_order_relaxed);
+  }
+
+  // Smallest bucket upper bound at or above kQuantile of the samples,
+  // capped at Max(); 0 when empty.
+  [[nodiscard]] std::uint64_t Percentile(const double kQuantile) const {
+    std::array<std::uint64_t, kBuckets> counts;
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i < kBuckets; ++i) {
+      counts[i] = counts_[i].load(std::memory_order_relaxed);
+      total += counts[i];
+    }
+    return PercentileOf(counts, total, kQuantile);
+  }
+
+  // The usual percentiles from one pass over the counts.
+  [[nodiscard]] Summary Summarize() const {
+    std::array<std::uint64_t, kBuckets> counts;
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i < kBuckets; ++i) {
+      counts[i] = counts_[i].load(std::memory_order_relaxed);
+      total += counts[i];
+    }
+    return {.count_ = total,
+            .p50_ = PercentileOf(counts, total, 0.5),
+            .p99_ = PercentileOf(counts, total, 0.99),
+            .p999_ = PercentileOf(counts, total, 0.999),
+            .max_ = Max()};
+  }
+
+  static std::size_t Index(const std::uint64_t kNanos) {
+    const std::uint64_t kValue =
+        std::min(kNanos, (std::uint64_t{1} << kMaxBits) - 1);
+    if (kValue < kSubBuckets) return kValue;
+    const unsigned kTop = std::bit_width(kValue) - 1;  // >= kSubBucketBits
+    const unsigned kShift = kTop - kSubBucketBits;
+    return ((kShift + 1) * kSubBuckets) + ((kValue >> kShift) - kSubBuckets);
+  }
+
+  // Largest value that falls in bucket kIndex.
+  static std::uint64_t UpperBound(const std::size_t kIndex) {
+    if (kIndex < kSubBuckets) return kIndex;
+    const std::size_t kShift = (kIndex / kSubBuckets) - 1;
+    const std::uint64_t kMantissa = kSubBuckets + (kIndex % kSubBuckets);
+    return ((kMantissa + 1) << kShift) - 1;
+  }
+
+ private:
+  std::uint64_t PercentileOf(const std::array<std::uint64_t, kBuckets>& kCounts,
+                             const std::uint64_t kTotal,
+                             const double kQuantile) const {
+    if (kTotal == 0) return 0;
+    const auto kRank = std::max<std::uint64_t>(
+        1, static_cast<std::uint64_t>(
+               std::ceil(std::clamp(kQuantile, 0.0, 1.0) *
+                         static_cast<double>(kTotal))));
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < kBuckets; ++i) {
+      seen += kCounts[i];
+      if (seen >= kRank) return std::min(UpperBound(i), Max());
+    }
+    return Max();
+  }
+
+  std::array<std::atomic<std::uint64_t>, kBuckets> counts_{};
+  std::atomic<std::uint64_t> max_{0};
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_LATENCY_HISTOGRAM_H
@@ -0,0 +1,78 @@
+#ifndef GOF23_PHILOX_H
+#define GOF23_PHILOX_H
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <utility>
+
+// Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy as 1, 2,
+// 3", SC'11). A counter-based generator: the output is a pure function of
+// (key, counter), so any stream position can be drawn directly and work can
+// be split across threads without the draws depending on the split.
+//
+// NOLINTBEGIN(readability-identifier-naming)
+
+class Philox4x32 {
+ public:
+  using Counter = std::array<std::uint32_t, 4>;
+  using Key = std::array<std::uint32_t, 2>;
+
+  constexpr explicit Philox4x32(const Key kKey) : key_(kKey) {}
+
+  // Key from a 64-bit seed, low word first.
+  constexpr explicit Philox4x32(const std::uint64_t kSeed)
+      : key_{static_cast<std::uint32_t>(kSeed),
+             static_cast<std::uint32_t>(kSeed >> 32)} {}
+
+  [[nodiscard]] constexpr Counter operator()(Counter counter) const {
+    Key key = key_;
+    for (int round = 0; round < 10; ++round) {
+      if (round > 0) {
+        key[0] += kWeyl0;
+        key[1] += kWeyl1;
+      }
+      const std::uint64_t kProduct0 =
+          static_cast<std::uint64_t>(kMultiplier0) * counter[0];
+      const std::uint64_t kProduct1 =
+          static_cast<std::uint64_t>(kMultiplier1) * counter[2];
+      counter = {static_cast<std::uint32_t>(kProduct1 >> 32) ^ counter[1] ^
+                     key[0],
+                 static_cast<std::uint32_t>(kProduct1),
+                 static_cast<std::uint32_t>(kProduct0 >> 32) ^ counter[3] ^
+                     key[1],
+                 static_cast<std::uint32_t>(kProduct0)};
+    }
+    return counter;
+  }
+
+  // Uniform on the open interval (0, 1) from 53 bits of two output words.
+  [[nodiscard]] static constexpr double ToUnit(const std::uint32_t kHigh,
+                                               const std::uint32_t kLow) {
+    const std::uint64_t kBits =
+        ((static_cast<std::uint64_t>(kHigh) << 32) | kLow) >> 11;
+    return (static_cast<double>(kBits) + 0.5) * 0x1p-53;
+  }
+
+  // Two independent standard normals (Box-Muller) from one block.
+  [[nodiscard]] static std::pair<double, double> ToNormals(
+      const Counter& kBlock) {
+    const double kRadius =
+        std::sqrt(-2 * std::log(ToUnit(kBlock[0], kBlock[1])));
+    const double kAngle = 2 * std::numbers::pi * ToUnit(kBlock[2], kBlock[3]);
+    return {kRadius * std::cos(kAngle), kRadius * std::sin(kAngle)};
+  }
+
+ private:
+  static constexpr std::uint32_t kMultiplier0 = 0xD2511F53;
+  static constexpr std::uint32_t kMultiplier1 = 0xCD9E8D57;
+  static constexpr std::uint32_t kWeyl0 = 0x9E3779B9;
+  static constexpr std::uint32_t kWeyl1 = 0xBB67AE85;
+
+  Key key_;
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_PHILOX_H
@@ -0,0 +1,319 @@
+#ifndef GOF23_SIMD_LANES_H
+#define GOF23_SIMD_LANES_H
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numbers>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+// Lane types share one interface so a kernel can be written once as a
+// template and instantiated for the widest ISA the translation unit was
+// compiled for (see GOF23_MARCH_NATIVE). Arithmetic uses the builtin vector
+// operators; everything else goes through the static members below.
+//
+// NOLINTBEGIN(readability-identifier-naming)
+
+struct ScalarLanes {
+  using Reg = double;
+  using Mask = bool;
+  static constexpr std::size_t kWidth = 1;
+  static constexpr const char* kName = "scalar";
+
+  static Reg Set1(const double kVal) { return kVal; }
+  static Reg Load(const double* src) { return *src; }
+  static void Store(double* dst, const Reg kVal) { *dst = kVal; }
+
+  template <class E>
+  static Mask LoadEq(const E* src, const E kVal) {
+    static_assert(sizeof(E) == 1);
+    return *src == kVal;
+  }
+
+  // std::fma is a libm call without hardware FMA, so fall back to mul + add.
+  static Reg Fma(const Reg kA, const Reg kB, const Reg kC) {
+#if defined(__FMA__)
+    return std::fma(kA, kB, kC);
+#else
+    return (kA * kB) + kC;
+#endif
+  }
+  static Reg Sqrt(const Reg kVal) { return std::sqrt(kVal); }
+  static Reg Abs(const Reg kVal) { return std::fabs(kVal); }
+  static Reg Min(const Reg kA, const Reg kB) { return std::min(kA, kB); }
+  static Reg Max(const Reg kA, const Reg kB) { return std::max(kA, kB); }
+  static Reg Round(const Reg kVal) { return std::nearbyint(kVal); }
+
+  static Mask Lt(const Reg kA, const Reg kB) { return kA < kB; }
+  static Mask Le(const Reg kA, const Reg kB) { return kA <= kB; }
+  static Mask Gt(const Reg kA, const Reg kB) { return kA > kB; }
+  static Mask Or(const Mask kA, const Mask kB) { return kA || kB; }
+  static Mask And(const Mask kA, const Mask kB) { return kA && kB; }
+  static Mask AndNot(const Mask kA, const Mask kB) { return kA && !kB; }
+  static bool Any(const Mask kMask) { return kMask; }
+  static Reg Select(const Mask kMask, const Reg kA, const Reg kB) {
+    return kMask ? kA : kB;
+  }
+
+  // 2^k for an integral k in [-1022, 1023].
+  static Reg Pow2(const Reg kExp) {
+    const auto kBiased = static_cast<std::uint64_t>(kExp + 1023);
+    return std::bit_cast<double>(kBiased << 52);
+  }
+  // Unbiased exponent and [1, 2) mantissa of a positive normal value.
+  static Reg Exponent(const Reg kVal) {
+    const auto kBits = std::bit_cast<std::uint64_t>(kVal);
+    return static_cast<double>(kBits >> 52) - 1023;
+  }
+  static Reg Mantissa(const Reg kVal) {
+    const auto kBits = std::bit_cast<std::uint64_t>(kVal);
+    return std::bit_cast<double>((kBits & 0x000FFFFFFFFFFFFFULL) |
+                                 0x3FF0000000000000ULL);
+  }
+
+  static double ReduceAdd(const Reg kVal) { return kVal; }
+};
+
+#if defined(__AVX2__) && defined(__FMA__)
+struct Avx2Lanes {
+  using Reg = __m256d;
+  using Mask = __m256d;
+  static constexpr std::size_t kWidth = 4;
+  static constexpr const char* kName = "avx2";
+
+  static Reg Set1(const double kVal) { return _mm256_set1_pd(kVal); }
+  static Reg Load(const double* src) { return _mm256_loadu_pd(src); }
+  static void Store(double* dst, const Reg kVal) {
+    _mm256_storeu_pd(dst, kVal);
+  }
+
+  template <class E>
+  static Mask LoadEq(const E* src, const E kVal) {
+    static_assert(sizeof(E) == 1);
+    std::int32_t bytes = 0;
+    std::memcpy(&bytes, src, sizeof(bytes));
+    const __m256i kWide = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(bytes));
+    return _mm256_castsi256_pd(_mm256_cmpeq_epi64(
+        kWide, _mm256_set1_epi64x(static_cast<std::int64_t>(kVal))));
+  }
+
+  static Reg Fma(const Reg kA, const Reg kB, const Reg kC) {
+    return _mm256_fmadd_pd(kA, kB, kC);
+  }
+  static Reg Sqrt(const Reg kVal) { return _mm256_sqrt_pd(kVal); }
+  static Reg Abs(const Reg kVal) {
+    return _mm256_andnot_pd(_mm256_set1_pd(-0.0), kVal);
+  }
+  static Reg Min(const Reg kA, const Reg kB) { return _mm256_min_pd(kA, kB); }
+  static Reg Max(const Reg kA, const Reg kB) { return _mm256_max_pd(kA, kB); }
+  static Reg Round(const Reg kVal) {
+    return _mm256_round_pd(kVal, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  }
+
+  static Mask Lt(const Reg kA, const Reg kB) {
+    return _mm256_cmp_pd(kA, kB, _CMP_LT_OQ);
+  }
+  static Mask Le(const Reg kA, const Reg kB) {
+    return _mm256_cmp_pd(kA, kB, _CMP_LE_OQ);
+  }
+  static Mask Gt(const Reg kA, const Reg kB) {
+    return _mm256_cmp_pd(kA, kB, _CMP_GT_OQ);
+  }
+  static Mask Or(const Mask kA, const Mask kB) { return _mm256_or_pd(kA, kB); }
+  static Mask And(const Mask kA, const Mask kB) {
+    return _mm256_and_pd(kA, kB);
+  }
+  static Mask AndNot(const Mask kA, const Mask kB) {
+    return _mm256_andnot_pd(kB, kA);
+  }
+  static bool Any(const Mask kMask) { return _mm256_movemask_pd(kMask) != 0; }
+  static Reg Select(const Mask kMask, const Reg kA, const Reg kB) {
+    return _mm256_blendv_pd(kB, kA, kMask);
+  }
+
+  static Reg Pow2(const Reg kExp) {
+    // Adding 2^52 parks the integral exponent in the low mantissa bits.
+    constexpr double kShift = 0x1p52;
+    const __m256i kBiased =
+        _mm256_sub_epi64(_mm256_castpd_si256(kExp + Set1(kShift + 1023)),
+                         _mm256_castpd_si256(Set1(kShift)));
+    return _mm256_castsi256_pd(_mm256_slli_epi64(kBiased, 52));
+  }
+  static Reg Exponent(const Reg kVal) {
+    constexpr double kShift = 0x1p52;
+    const __m256i kRaw = _mm256_srli_epi64(_mm256_castpd_si256(kVal), 52);
+    const __m256d kAsDouble = _mm256_castsi256_pd(
+        _mm256_or_si256(kRaw, _mm256_castpd_si256(Set1(kShift))));
+    return kAsDouble - Set1(kShift + 1023);
+  }
+  static Reg Mantissa(const Reg kVal) {
+    const __m256i kBits = _mm256_castpd_si256(kVal);
+    const __m256i kFrac =
+        _mm256_and_si256(kBits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL));
+    return _mm256_castsi256_pd(
+        _mm256_or_si256(kFrac, _mm256_set1_epi64x(0x3FF0000000000000LL)));
+  }
+
+  static double ReduceAdd(const Reg kVal) {
+    const __m128d kPair = _mm_add_pd(_mm256_castpd256_pd128(kVal),
+                                     _mm256_extractf128_pd(kVal, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(kPair, _mm_unpackhi_pd(kPair, kPair)));
+  }
+};
+#endif
+
+#if defined(__AVX512F__)
+struct Avx512Lanes {
+  using Reg = __m512d;
+  using Mask = __mmask8;
+  static constexpr std::size_t kWidth = 8;
+  static constexpr const char* kName = "avx512";
+
+  static Reg Set1(const double kVal) { return _mm512_set1_pd(kVal); }
+  static Reg Load(const double* src) { return _mm512_loadu_pd(src); }
+  static void Store(double* dst, const Reg kVal) {
+    _mm512_storeu_pd(dst, kVal);
+  }
+
+  template <class E>
+  static Mask LoadEq(const E* src, const E kVal) {
+    static_assert(sizeof(E) == 1);
+    std::int64_t bytes = 0;
+    std::memcpy(&bytes, src, sizeof(bytes));
+    const __m512i kWide = _mm512_cvtepu8_epi64(_mm_cvtsi64_si128(bytes));
+    return _mm512_cmpeq_epi64_mask(
+        kWide, _mm512_set1_epi64(static_cast<std::int64_t>(kVal)));
+  }
+
+  static Reg Fma(const Reg kA, const Reg kB, const Reg kC) {
+    return _mm512_fmadd_pd(kA, kB, kC);
+  }
+  static Reg Sqrt(const Reg kVal) { return _mm512_sqrt_pd(kVal); }
+  static Reg Abs(const Reg kVal) { return _mm512_abs_pd(kVal); }
+  static Reg Min(const Reg kA, const Reg kB) { return _mm512_min_pd(kA, kB); }
+  static Reg Max(const Reg kA, const Reg kB) { return _mm512_max_pd(kA, kB); }
+  static Reg Round(const Reg kVal) {
+    return _mm512_roundscale_pd(kVal,
+                                _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  }
+
+  static Mask Lt(const Reg kA, const Reg kB) {
+    return _mm512_cmp_pd_mask(kA, kB, _CMP_LT_OQ);
+  }
+  static Mask Le(const Reg kA, const Reg kB) {
+    return _mm512_cmp_pd_mask(kA, kB, _CMP_LE_OQ);
+  }
+  static Mask Gt(const Reg kA, const Reg kB) {
+    return _mm512_cmp_pd_mask(kA, kB, _CMP_GT_OQ);
+  }
+  static Mask Or(const Mask kA, const Mask kB) {
+    return static_cast<Mask>(kA | kB);
+  }
+  static Mask And(const Mask kA, const Mask kB) {
+    return static_cast<Mask>(kA & kB);
+  }
+  static Mask AndNot(const Mask kA, const Mask kB) {
+    return static_cast<Mask>(kA & ~kB);
+  }
+  static bool Any(const Mask kMask) { return kMask != 0; }
+  static Reg Select(const Mask kMask, const Reg kA, const Reg kB) {
+    return _mm512_mask_blend_pd(kMask, kB, kA);
+  }
+
+  static Reg Pow2(const Reg kExp) {
+    return _mm512_scalef_pd(Set1(1.0), kExp);
+  }
+  static Reg Exponent(const Reg kVal) { return _mm512_getexp_pd(kVal); }
+  static Reg Mantissa(const Reg kVal) {
+    return _mm512_getmant_pd(kVal, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_src);
+  }
+
+  static double ReduceAdd(const Reg kVal) { return _mm512_reduce_add_pd(kVal); }
+};
+#endif
+
+#if defined(__AVX512F__)
+using NativeLanes = Avx512Lanes;
+#elif defined(__AVX2__) && defined(__FMA__)
+using NativeLanes = Avx2Lanes;
+#else
+using NativeLanes = ScalarLanes;
+#endif
+
+// Horner evaluation with the coefficients ordered from highest degree down.
+template <class V, std::size_t N>
+typename V::Reg Horner(const typename V::Reg kX, const double (&coeffs)[N]) {
+  typename V::Reg acc = V::Set1(coeffs[0]);
+  for (std::size_t i = 1; i < N; ++i) {
+    acc = V::Fma(acc, kX, V::Set1(coeffs[i]));
+  }
+  return acc;
+}
+
+// e^x after fdlibm's reduction x = k ln2 + r; within 1 ulp on [-708, 709],
+// inputs outside that range are clamped.
+template <class V>
+typename V::Reg Exp(const typename V::Reg kVal) {
+  using Reg = typename V::Reg;
+  constexpr double kLn2Hi = 6.93147180369123816490e-01;
+  constexpr double kLn2Lo = 1.90821492927058770002e-10;
+  constexpr double kInvLn2 = 1.44269504088896338700e+00;
+  constexpr double kP[] = {4.13813679705723846039e-08,
+                           -1.65339022054652515390e-06,
+                           6.61375632143793436117e-05,
+                           -2.77777777770155933842e-03,
+                           1.66666666666666019037e-01};
+
+  const Reg kX = V::Min(V::Max(kVal, V::Set1(-708.0)), V::Set1(709.0));
+  const Reg kK = V::Round(kX * V::Set1(kInvLn2));
+  const Reg kHi = V::Fma(kK, V::Set1(-kLn2Hi), kX);
+  const Reg kLo = kK * V::Set1(kLn2Lo);
+  const Reg kR = kHi - kLo;
+  const Reg kT = kR * kR;
+  const Reg kC = kR - kT * Horner<V>(kT, kP);
+  const Reg kY =
+      V::Set1(1.0) - ((kLo - (kR * kC) / (V::Set1(2.0) - kC)) - kHi);
+  return kY * V::Pow2(kK);
+}
+
+// Natural log of a positive normal value after fdlibm's reduction to
+// [sqrt(2)/2, sqrt(2)); within 1 ulp. Zero, negatives and non-finite inputs
+// are the caller's responsibility.
+template <class V>
+typename V::Reg Log(const typename V::Reg kVal) {
+  using Reg = typename V::Reg;
+  constexpr double kLn2Hi = 6.93147180369123816490e-01;
+  constexpr double kLn2Lo = 1.90821492927058770002e-10;
+  constexpr double kEven[] = {1.531383769920937332e-01,
+                              2.222219843214978396e-01,
+                              3.999999999940941908e-01};
+  constexpr double kOdd[] = {1.479819860511658591e-01,
+                             1.818357216161805012e-01,
+                             2.857142874366239149e-01,
+                             6.666666666666735130e-01};
+
+  Reg mantissa = V::Mantissa(kVal);
+  Reg exponent = V::Exponent(kVal);
+  const auto kHigh = V::Gt(mantissa, V::Set1(std::numbers::sqrt2));
+  mantissa = V::Select(kHigh, mantissa * V::Set1(0.5), mantissa);
+  exponent = V::Select(kHigh, exponent + V::Set1(1.0), exponent);
+
+  const Reg kF = mantissa - V::Set1(1.0);
+  const Reg kS = kF / (V::Set1(2.0) + kF);
+  const Reg kZ = kS * kS;
+  const Reg kW = kZ * kZ;
+  const Reg kR = kW * Horner<V>(kW, kEven) + kZ * Horner<V>(kW, kOdd);
+  const Reg kHfsq = V::Set1(0.5) * kF * kF;
+  return exponent * V::Set1(kLn2Hi) -
+         ((kHfsq - (kS * (kHfsq + kR) + exponent * V::Set1(kLn2Lo))) - kF);
+}
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_SIMD_LANES_H
@@ -0,0 +1,102 @@
+#ifndef GOF23_SPSC_RING_H
+#define GOF23_SPSC_RING_H
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+// A bounded queue between exactly one producer thread and one consumer
+// thread. Each side owns one index and only publishes it, with a release
+// store; neither ever writes the other's line. Each keeps its last view of
+// the other's index on its own line too, and reloads it only when that
+// view says the ring is full (producer) or empty (consumer), so a busy
+// ring costs about one shared-line transfer per wrap rather than per item.
+//
+// The consumer reads items in place: Front() is the longest run it can see
+// without wrapping, and Pop() hands the slots back once it is done.
+//
+// NOLINTBEGIN(readability-identifier-naming)
+
+template <class T>
+class SpscRing {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "items are copied into slots and read in place");
+
+ public:
+  // Rounded up to a power of two.
+  explicit SpscRing(const std::size_t kCapacity)
+      : mask_(std::bit_ceil(std::max<std::size_t>(kCapacity, 2)) - 1),
+        slots_(std::make_unique<T[]>(mask_ + 1)) {}
+
+  SpscRing(const SpscRing&) = delete;
+  SpscRing& operator=(const SpscRing&) = delete;
+
+  [[nodiscard]] std::size_t Capacity() const { return mask_ + 1; }
+
+  // Producer only. False when the ring is full.
+  bool TryPush(const T& kItem) {
+    const std::uint64_t kTail = producer_.tail_.load(std::memory_order_relaxed);
+    if (kTail - producer_.head_seen_ > mask_) {
+      producer_.head_seen_ = consumer_.head_.load(std::memory_order_acquire);
+      if (kTail - producer_.head_seen_ > mask_) return false;
+    }
+    slots_[kTail & mask_] = kItem;
+    producer_.tail_.store(kTail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer only. Up to kMax items from the head, in order, left in their
+  // slots until Pop; empty when the ring is.
+  std::span<const T> Front(const std::size_t kMax) {
+    const std::uint64_t kHead = consumer_.head_.load(std::memory_order_relaxed);
+    if (consumer_.tail_seen_ == kHead) {
+      consumer_.tail_seen_ = producer_.tail_.load(std::memory_order_acquire);
+    }
+    const std::size_t kStart = kHead & mask_;
+    const std::size_t kCount = std::min<std::uint64_t>(
+        {consumer_.tail_seen_ - kHead, Capacity() - kStart, kMax});
+    return {&slots_[kStart], kCount};
+  }
+
+  // Consumer only. Frees the first kCount items of the last Front().
+  void Pop(const std::size_t kCount) {
+    consumer_.head_.store(
+        consumer_.head_.load(std::memory_order_relaxed) + kCount,
+        std::memory_order_release);
+  }
+
+  // Either side, as of some recent moment.
+  [[nodiscard]] bool Empty() const {
+    return consumer_.head_.load(std::memory_order_acquire) ==
+           producer_.tail_.load(std::memory_order_acquire);
+  }
+  [[nodiscard]] bool Full() const {
+    return producer_.tail_.load(std::memory_order_acquire) -
+               consumer_.head_.load(std::memory_order_acquire) >
+           mask_;
+  }
+
+ private:
+  struct alignas(64) Producer {
+    std::atomic<std::uint64_t> tail_{0};
+    std::uint64_t head_seen_ = 0;
+  };
+  struct alignas(64) Consumer {
+    std::atomic<std::uint64_t> head_{0};
+    std::uint64_t tail_seen_ = 0;
+  };
+
+  Producer producer_;
+  Consumer consumer_;
+  std::size_t mask_;
+  std::unique_ptr<T[]> slots_;
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_SPSC_RING_H
@@ -0,0 +1,193 @@
+#ifndef GOF23_WORK_STEALING_POOL_H
+#define GOF23_WORK_STEALING_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// A fixed set of worker threads for data-parallel loops. ParallelFor cuts
+// [0, count) into chunks of grain items and deals each participant an equal
+// run of chunks up front. Participants take chunks from the front of their
+// own run, and once it is empty steal the back half of someone else's, so
+// uneven chunks still balance without a shared queue to contend on.
+//
+// A run is one 64-bit word (first chunk, end chunk), so the owner taking a
+// chunk and a thief splitting the run are both a single CAS on it.
+//
+// The caller's thread takes part, so Size() includes it and a one-thread pool
+// starts no workers. Chunk boundaries depend only on count and grain, never
+// on the thread count or on who ran what. ParallelFor is not reentrant, and
+// only one thread may call it at a time.
+//
+// NOLINTBEGIN(readability-identifier-naming)
+
+class WorkStealingPool {
+ public:
+  // kThreads == 0 means one per hardware thread.
+  explicit WorkStealingPool(const unsigned kThreads = 0)
+      : size_(std::max(1U, kThreads > 0 ? kThreads
+                                        : std::thread::hardware_concurrency())),
+        runs_(std::make_unique<Run[]>(size_)) {
+    for (unsigned worker = 1; worker < size_; ++worker) {
+      workers_.emplace_back([this, worker] { WorkerLoop(worker); });
+    }
+  }
+
+  ~WorkStealingPool() {
+    stop_.store(true, std::memory_order_relaxed);
+    generation_.fetch_add(1, std::memory_order_release);
+    generation_.notify_all();
+  }
+
+  WorkStealingPool(const WorkStealingPool&) = delete;
+  WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+  [[nodiscard]] unsigned Size() const { return size_; }
+
+  // Calls body(participant, begin, end) once for every chunk of
+  // [0, kCount), participant being in [0, Size()); the calling thread is
+  // participant 0. Returns once every chunk has run.
+  template <class Body>
+  void ParallelFor(const std::size_t kCount, const std::size_t kGrain,
+                   Body&& body) {
+    if (kCount == 0) return;
+    const std::size_t kGrainSize = std::max<std::size_t>(kGrain, 1);
+    const std::size_t kChunks = (kCount + kGrainSize - 1) / kGrainSize;
+    if (size_ == 1 || kChunks == 1) {
+      for (std::size_t begin = 0; begin < kCount; begin += kGrainSize) {
+        body(0U, begin, std::min(kCount, begin + kGrainSize));
+      }
+      return;
+    }
+
+    for (unsigned p = 0; p < size_; ++p) {
+      runs_[p].chunks_.store(
+          Pack(kChunks * p / size_, kChunks * (p + 1) / size_),
+          std::memory_order_relaxed);
+    }
+    job_ = {.body_ = const_cast<void*>(static_cast<const void*>(&body)),
+            .invoke_ = &Invoke<std::remove_reference_t<Body>>,
+            .count_ = kCount,
+            .grain_ = kGrainSize};
+    busy_.store(size_ - 1, std::memory_order_relaxed);
+    generation_.fetch_add(1, std::memory_order_release);
+    generation_.notify_all();
+
+    Drain(0);
+
+    // Every chunk has been claimed, but workers may still be running theirs
+    // or scanning for more; the job must outlive them all.
+    for (unsigned busy = busy_.load(std::memory_order_acquire); busy != 0;
+         busy = busy_.load(std::memory_order_acquire)) {
+      busy_.wait(busy, std::memory_order_acquire);
+    }
+  }
+
+ private:
+  static constexpr int kShift = 32;
+
+  struct alignas(64) Run {
+    std::atomic<std::uint64_t> chunks_{0};
+  };
+
+  struct Job {
+    void* body_{};
+    void (*invoke_)(void*, unsigned, std::size_t, std::size_t){};
+    std::size_t count_{};
+    std::size_t grain_{};
+  };
+
+  template <class Body>
+  static void Invoke(void* body, const unsigned kParticipant,
+                     const std::size_t kBegin, const std::size_t kEnd) {
+    (*static_cast<Body*>(body))(kParticipant, kBegin, kEnd);
+  }
+
+  static std::uint64_t Pack(const std::uint64_t kFirst,
+                            const std::uint64_t kEnd) {
+    return (kFirst << kShift) | kEnd;
+  }
+  static std::uint64_t First(const std::uint64_t kRun) {
+    return kRun >> kShift;
+  }
+  static std::uint64_t End(const std::uint64_t kRun) {
+    return kRun & ((std::uint64_t{1} << kShift) - 1);
+  }
+
+  void WorkerLoop(const unsigned kSelf) {
+    std::uint64_t seen = 0;
+    while (true) {
+      generation_.wait(seen, std::memory_order_acquire);
+      seen = generation_.load(std::memory_order_acquire);
+      if (stop_.load(std::memory_order_relaxed)) return;
+      Drain(kSelf);
+      if (busy_.fetch_sub(1, std::memory_order_release) == 1) {
+        busy_.notify_one();
+      }
+    }
+  }
+
+  // Runs chunks until there are none left to take or steal.
+  void Drain(const unsigned kSelf) {
+    std::size_t chunk = 0;
+    while (TakeOwn(kSelf, chunk) || Steal(kSelf, chunk)) {
+      const std::size_t kBegin = chunk * job_.grain_;
+      job_.invoke_(job_.body_, kSelf, kBegin,
+                   std::min(job_.count_, kBegin + job_.grain_));
+    }
+  }
+
+  bool TakeOwn(const unsigned kSelf, std::size_t& chunk) {
+    std::atomic<std::uint64_t>& own = runs_[kSelf].chunks_;
+    std::uint64_t run = own.load(std::memory_order_relaxed);
+    while (First(run) < End(run)) {
+      if (own.compare_exchange_weak(run, Pack(First(run) + 1, End(run)),
+                                    std::memory_order_relaxed)) {
+        chunk = First(run);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Splits the first non-empty run after kSelf's, keeps the back half and
+  // runs its first chunk.
+  bool Steal(const unsigned kSelf, std::size_t& chunk) {
+    for (unsigned offset = 1; offset < size_; ++offset) {
+      std::atomic<std::uint64_t>& victim =
+          runs_[(kSelf + offset) % size_].chunks_;
+      std::uint64_t run = victim.load(std::memory_order_relaxed);
+      while (First(run) < End(run)) {
+        const std::uint64_t kMid = First(run) + ((End(run) - First(run)) / 2);
+        if (victim.compare_exchange_weak(run, Pack(First(run), kMid),
+                                         std::memory_order_relaxed)) {
+          chunk = kMid;
+          runs_[kSelf].chunks_.store(Pack(kMid + 1, End(run)),
+                                     std::memory_order_relaxed);
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  unsigned size_;
+  std::unique_ptr<Run[]> runs_;
+  Job job_;
+
+  // Bumped to start a job or to stop; workers sleep on it in between.
+  std::atomic<std::uint64_t> generation_{0};
+  std::atomic<unsigned> busy_{0};  // workers still inside the current job
+  std::atomic<bool> stop_{false};
+
+  std::vector<std::jthread> workers_;  // last: joined before the rest goes
+};
+
+// NOLINTEND(readability-identifier-naming)
+
+#endif  // GOF23_WORK_STEALING_POOL_H